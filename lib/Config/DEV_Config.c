@@ -29,6 +29,24 @@
 #
 ******************************************************************************/
 #include "DEV_Config.h"
+#if DEV_SIM
+#include "DEV_Sim.h"
+#endif
+#if DEV_TRACE
+#include "DEV_Trace.h"
+#endif
+
+const DEV_PORT DEV_DefaultPort = {
+    .Sclk    = EPD_SCLK_PIN,
+    .Mosi    = EPD_MOSI_PIN,
+    .Cs      = EPD_CS_PIN,
+    .Dc      = EPD_DC_PIN,
+    .Rst     = EPD_RST_PIN,
+    .Busy    = EPD_BUSY_PIN,
+    .Pwr     = EPD_PWR_PIN,
+    .Spi     = SPI_ID,
+    .SpiFreq = SPI_FREQ,
+};
 
 /*GPIO output init*/
 TUYA_GPIO_BASE_CFG_T out_pin_cfg = {
@@ -40,16 +58,82 @@ TUYA_GPIO_BASE_CFG_T in_pin_cfg = {
     .direct = TUYA_GPIO_INPUT,
 };
 
+/**
+ * Direction last given to each pin: mode + 1, 0 unknown
+ **/
+#define DEV_PIN_CACHE 64
+static UBYTE DEV_PinMode[DEV_PIN_CACHE];
+
+/**
+ * Buses whose SCLK/MOSI were taken over as GPIO by a bit-banged transfer;
+ * the next hardware write hands them back to the SPI
+ **/
+#define DEV_SPI_BUSES 4
+static UBYTE DEV_SpiLent[DEV_SPI_BUSES];
+
+/**
+ * Clock set at runtime with DEV_Port_SetFreq(), 0: DEV_PORT.SpiFreq.
+ * DEV_SpiUp marks buses whose SPI is initialised and must be restarted.
+ **/
+static UDOUBLE DEV_SpiFreq[DEV_SPI_BUSES];
+static UBYTE   DEV_SpiUp[DEV_SPI_BUSES];
+
+static void DEV_GPIO_Forget(UWORD Pin)
+{
+    if (Pin < DEV_PIN_CACHE) {
+        DEV_PinMode[Pin] = 0;
+    }
+}
+
+static void DEV_SPI_Init(const DEV_PORT *Port)
+{
+#if !DEV_SIM
+    TUYA_SPI_BASE_CFG_T spi_cfg = {.mode     = TUYA_SPI_MODE0,
+                                   .freq_hz  = DEV_Port_GetFreq(Port),
+                                   .databits = TUYA_SPI_DATA_BIT8,
+                                   .bitorder = TUYA_SPI_ORDER_MSB2LSB,
+                                   .role     = TUYA_SPI_ROLE_MASTER,
+                                   .type     = TUYA_SPI_SOFT_ONE_WIRE_TYPE};
+    tkl_spi_init(Port->Spi, &spi_cfg);
+#endif
+    if (Port->Spi < DEV_SPI_BUSES) {
+        DEV_SpiLent[Port->Spi] = 0;
+        DEV_SpiUp[Port->Spi]   = 1;
+    }
+}
+
+static void DEV_SPI_Reclaim(const DEV_PORT *Port)
+{
+    if (Port->Spi < DEV_SPI_BUSES && DEV_SpiLent[Port->Spi]) {
+#if !DEV_SIM
+        tkl_spi_deinit(Port->Spi); // Still initialised under the borrowed pins
+#endif
+        DEV_SPI_Init(Port);
+        DEV_GPIO_Forget(Port->Sclk);
+        DEV_GPIO_Forget(Port->Mosi);
+    }
+}
+
 /**
  * GPIO read and write
  **/
 void DEV_Digital_Write(UWORD Pin, UBYTE Value)
 {
+#if DEV_TRACE
+    DEV_Trace_Pin(Pin, Value);
+#endif
+#if DEV_SIM
+    DEV_Sim_Write(Pin, Value);
+#else
     tkl_gpio_write(Pin, Value);
+#endif
 }
 
 UBYTE DEV_Digital_Read(UWORD Pin)
 {
+#if DEV_SIM
+    return DEV_Sim_Read(Pin);
+#else
     TUYA_GPIO_LEVEL_E read_level = 0;
 
     tkl_gpio_read(Pin, &read_level);
@@ -58,31 +142,116 @@ UBYTE DEV_Digital_Read(UWORD Pin)
         return 0;
     else
         return 1;
+#endif
 }
 
 /**
  * SPI
  **/
+void DEV_Port_WriteByte(const DEV_PORT *Port, UBYTE Value)
+{
+#if DEV_TRACE
+    DEV_Trace_Spi(Port->Spi, &Value, 1);
+#endif
+    DEV_SPI_Reclaim(Port);
+#if DEV_SIM
+    DEV_Sim_Spi(Port, &Value, 1);
+#else
+    tkl_spi_send(Port->Spi, &Value, 1);
+#endif
+}
+
+void DEV_Port_Write_nByte(const DEV_PORT *Port, uint8_t *pData, uint32_t Len)
+{
+#if DEV_TRACE
+    DEV_Trace_Spi(Port->Spi, pData, Len);
+#endif
+    DEV_SPI_Reclaim(Port);
+#if DEV_SIM
+    DEV_Sim_Spi(Port, pData, Len);
+#else
+    tkl_spi_send(Port->Spi, pData, Len);
+#endif
+}
+
+/******************************************************************************
+function :  Send a command and/or data from several buffers in one CS window
+parameter:
+    Port   : Panel wiring
+    Segs   : Buffers in send order; empty ones are skipped
+    Count  : Number of segments
+    DcMode : DEV_SPI_DC_CMD: the first byte is the command (DC low), the
+             rest goes out with DC high; DEV_SPI_DC_DATA: all data
+info:
+    Headers and payload are sent where they lie, nothing is copied
+    together. With a DMA SPI the buffers must be in RAM, not flash.
+******************************************************************************/
+void DEV_Port_Writev(const DEV_PORT *Port, const DEV_SPI_SEG *Segs, UBYTE Count, UBYTE DcMode)
+{
+    UBYTE Cmd   = (DcMode == DEV_SPI_DC_CMD);
+    UBYTE DcLow = Cmd;
+    UBYTE i;
+
+    DEV_Digital_Write(Port->Dc, Cmd ? 0 : 1);
+    DEV_Digital_Write(Port->Cs, 0);
+    for (i = 0; i < Count; i++) {
+        const UBYTE *Data = Segs[i].Data;
+        UDOUBLE      Len  = Segs[i].Len;
+
+        if (Cmd && Len > 0) {
+            DEV_Port_WriteByte(Port, *Data);
+            Data++;
+            Len--;
+            Cmd = 0;
+        }
+        while (Len > 0) {
+            UDOUBLE n = (Len > DEV_SPI_XFER_MAX) ? DEV_SPI_XFER_MAX : Len;
+
+            if (DcLow) { // Raised only when parameters follow the command
+                DEV_Digital_Write(Port->Dc, 1);
+                DcLow = 0;
+            }
+            DEV_Port_Write_nByte(Port, (uint8_t *)Data, n);
+            Data += n;
+            Len -= n;
+        }
+    }
+    DEV_Digital_Write(Port->Cs, 1);
+}
+
 void DEV_SPI_WriteByte(uint8_t Value)
 {
-    tkl_spi_send(SPI_ID, &Value, 1);
+    DEV_Port_WriteByte(&DEV_DefaultPort, Value);
 }
 
 void DEV_SPI_Write_nByte(uint8_t *pData, uint32_t Len)
 {
-    tkl_spi_send(SPI_ID, pData, Len);
+    DEV_Port_Write_nByte(&DEV_DefaultPort, pData, Len);
+}
+
+void DEV_SPI_Writev(const DEV_SPI_SEG *Segs, UBYTE Count, UBYTE DcMode)
+{
+    DEV_Port_Writev(&DEV_DefaultPort, Segs, Count, DcMode);
 }
 
 /**
- * GPIO Mode
+ * GPIO Mode, 0: input; only a change of direction reaches tkl_gpio_init()
  **/
 void DEV_GPIO_Mode(UWORD Pin, UWORD Mode)
 {
+    if (Pin < DEV_PIN_CACHE && DEV_PinMode[Pin] == Mode + 1) {
+        return;
+    }
+#if !DEV_SIM
     if (Mode == 0) {
         tkl_gpio_init(Pin, &in_pin_cfg);
     } else {
         tkl_gpio_init(Pin, &out_pin_cfg);
     }
+#endif
+    if (Pin < DEV_PIN_CACHE) {
+        DEV_PinMode[Pin] = Mode + 1;
+    }
 }
 
 /**
@@ -90,97 +259,252 @@ void DEV_GPIO_Mode(UWORD Pin, UWORD Mode)
  **/
 void DEV_Delay_ms(UDOUBLE xms)
 {
+#if DEV_SIM
+    DEV_Sim_Delay_ms(xms);
+#else
     tal_system_sleep(xms);
+#endif
+}
+
+/**
+ * millisecond tick, used for timing transfers and busy phases
+ **/
+UDOUBLE DEV_Get_ms(void)
+{
+#if DEV_SIM
+    return DEV_Sim_Get_ms();
+#else
+    return (UDOUBLE)tal_system_get_millisecond();
+#endif
 }
 
-void DEV_GPIO_Init(void)
+static void DEV_GPIO_Init(const DEV_PORT *Port)
 {
-    DEV_GPIO_Mode(EPD_BUSY_PIN, 0);
-    DEV_GPIO_Mode(EPD_RST_PIN, 1);
-    DEV_GPIO_Mode(EPD_DC_PIN, 1);
-    DEV_GPIO_Mode(EPD_CS_PIN, 1);
-    DEV_GPIO_Mode(EPD_PWR_PIN, 1);
-    // DEV_GPIO_Mode(EPD_MOSI_PIN, 0);
-    // DEV_GPIO_Mode(EPD_SCLK_PIN, 1);
+    DEV_GPIO_Mode(Port->Busy, 0);
+    DEV_GPIO_Mode(Port->Rst, 1);
+    DEV_GPIO_Mode(Port->Dc, 1);
+    DEV_GPIO_Mode(Port->Cs, 1);
+    DEV_GPIO_Mode(Port->Pwr, 1);
+    // DEV_GPIO_Mode(Port->Mosi, 0);
+    // DEV_GPIO_Mode(Port->Sclk, 1);
 
-    DEV_Digital_Write(EPD_CS_PIN, 1);
-    DEV_Digital_Write(EPD_PWR_PIN, 1);
+    DEV_Digital_Write(Port->Cs, 1);
+    DEV_Digital_Write(Port->Pwr, 1);
 }
 
-void DEV_SPI_SendnData(UBYTE *Reg)
+/**
+ * Bit-banged 3-wire SPI: SDA (MOSI) is driven for writes and turned
+ * around for reads. The caller sets the pin directions.
+ **/
+static void DEV_SPI_Lend(const DEV_PORT *Port)
 {
-    UDOUBLE size;
-    size = sizeof(Reg);
-    for (UDOUBLE i = 0; i < size; i++) {
-        DEV_SPI_SendData(Reg[i]);
+    if (Port->Spi < DEV_SPI_BUSES) {
+        DEV_SpiLent[Port->Spi] = 1;
     }
+    DEV_GPIO_Mode(Port->Sclk, 1);
 }
 
-void DEV_SPI_SendData(UBYTE Reg)
+static void DEV_SPI_BitWrite(const DEV_PORT *Port, UBYTE Value)
 {
-    UBYTE i, j = Reg;
-    DEV_GPIO_Mode(EPD_MOSI_PIN, 1);
-    DEV_Digital_Write(EPD_CS_PIN, 0);
+    UBYTE i, j = Value;
     for (i = 0; i < 8; i++) {
-        DEV_Digital_Write(EPD_SCLK_PIN, 0);
+        DEV_Digital_Write(Port->Sclk, 0);
         if (j & 0x80) {
-            DEV_Digital_Write(EPD_MOSI_PIN, 1);
+            DEV_Digital_Write(Port->Mosi, 1);
         } else {
-            DEV_Digital_Write(EPD_MOSI_PIN, 0);
+            DEV_Digital_Write(Port->Mosi, 0);
         }
 
-        DEV_Digital_Write(EPD_SCLK_PIN, 1);
+        DEV_Digital_Write(Port->Sclk, 1);
         j = j << 1;
     }
-    DEV_Digital_Write(EPD_SCLK_PIN, 0);
-    DEV_Digital_Write(EPD_CS_PIN, 1);
+    DEV_Digital_Write(Port->Sclk, 0);
 }
 
-UBYTE DEV_SPI_ReadData()
+static UBYTE DEV_SPI_BitRead(const DEV_PORT *Port)
 {
     UBYTE i, j = 0xff;
-    DEV_GPIO_Mode(EPD_MOSI_PIN, 0);
-    DEV_Digital_Write(EPD_CS_PIN, 0);
     for (i = 0; i < 8; i++) {
-        DEV_Digital_Write(EPD_SCLK_PIN, 0);
+        DEV_Digital_Write(Port->Sclk, 0);
         j = j << 1;
-        if (DEV_Digital_Read(EPD_MOSI_PIN)) {
+        if (DEV_Digital_Read(Port->Mosi)) {
             j = j | 0x01;
         } else {
             j = j & 0xfe;
         }
-        DEV_Digital_Write(EPD_SCLK_PIN, 1);
+        DEV_Digital_Write(Port->Sclk, 1);
     }
-    DEV_Digital_Write(EPD_SCLK_PIN, 0);
-    DEV_Digital_Write(EPD_CS_PIN, 1);
+    DEV_Digital_Write(Port->Sclk, 0);
     return j;
 }
 
-UBYTE DEV_Module_Init(void)
+void DEV_SPI_SendData(UBYTE Reg)
+{
+    const DEV_PORT *Port = &DEV_DefaultPort;
+
+    DEV_SPI_Lend(Port);
+    DEV_GPIO_Mode(Port->Mosi, 1);
+    DEV_Digital_Write(Port->Cs, 0);
+    DEV_SPI_BitWrite(Port, Reg);
+    DEV_Digital_Write(Port->Cs, 1);
+}
+
+UBYTE DEV_SPI_ReadData()
+{
+    const DEV_PORT *Port = &DEV_DefaultPort;
+    UBYTE           j;
+
+    DEV_SPI_Lend(Port);
+    DEV_GPIO_Mode(Port->Mosi, 0);
+    DEV_Digital_Write(Port->Cs, 0);
+    j = DEV_SPI_BitRead(Port);
+    DEV_Digital_Write(Port->Cs, 1);
+    return j;
+}
+
+/******************************************************************************
+function :  Read a controller register over 3-wire SPI
+parameter:
+    Port : Panel wiring
+    Reg  : Register (command) to read
+    Buf  : Receives the response
+    Len  : Response length
+return   :  0 read; 1 nothing answered (all bits high)
+info:
+    Command and response share one CS window: DC low for the command,
+    then SDA is turned around and Len bytes are clocked in with DC high.
+    Pin directions are cached, so repeated reads only re-init SDA when it
+    actually changes direction. The hardware SPI gets SCLK/MOSI back on
+    its next write.
+******************************************************************************/
+UBYTE DEV_Port_ReadReg(const DEV_PORT *Port, UBYTE Reg, UBYTE *Buf, UBYTE Len)
+{
+    UBYTE Answer = 0;
+    UBYTE i;
+
+#if DEV_SIM
+    DEV_Sim_ReadReg(Port, Reg, Buf, Len);
+#else
+    DEV_SPI_Lend(Port);
+    DEV_GPIO_Mode(Port->Mosi, 1);
+    DEV_Digital_Write(Port->Dc, 0);
+    DEV_Digital_Write(Port->Cs, 0);
+    DEV_SPI_BitWrite(Port, Reg);
+    DEV_Digital_Write(Port->Dc, 1);
+    DEV_GPIO_Mode(Port->Mosi, 0);
+    for (i = 0; i < Len; i++) {
+        Buf[i] = DEV_SPI_BitRead(Port);
+    }
+    DEV_Digital_Write(Port->Cs, 1);
+#endif
+    for (i = 0; i < Len; i++) {
+        Answer |= (UBYTE)~Buf[i];
+    }
+    return Answer ? 0 : 1;
+}
+
+UBYTE DEV_SPI_ReadReg(UBYTE Reg, UBYTE *Buf, UBYTE Len)
+{
+    return DEV_Port_ReadReg(&DEV_DefaultPort, Reg, Buf, Len);
+}
+
+/******************************************************************************
+function :	Change the SPI clock of a port at runtime
+parameter:
+    Port :  Wiring of the panel
+    Hz   :  New clock, 0 goes back to DEV_PORT.SpiFreq
+return   :  0 set; 1 bus out of range
+info:
+    Takes effect at once when the bus is running, otherwise at DEV_Port_Init().
+    The setting outlives DEV_Port_Exit().
+******************************************************************************/
+UBYTE DEV_Port_SetFreq(const DEV_PORT *Port, UDOUBLE Hz)
+{
+    if (Port->Spi >= DEV_SPI_BUSES) {
+        Debug("SPI %d: no runtime clock\r\n", Port->Spi);
+        return 1;
+    }
+    if (DEV_SpiFreq[Port->Spi] == Hz) {
+        return 0;
+    }
+    DEV_SpiFreq[Port->Spi] = Hz;
+    Debug("SPI %d: %u Hz\r\n", Port->Spi, DEV_Port_GetFreq(Port));
+
+    if (DEV_SpiUp[Port->Spi]) {
+#if !DEV_SIM
+        tkl_spi_deinit(Port->Spi);
+#endif
+        DEV_SPI_Init(Port);
+        DEV_GPIO_Forget(Port->Sclk);
+        DEV_GPIO_Forget(Port->Mosi);
+    }
+    return 0;
+}
+
+UDOUBLE DEV_Port_GetFreq(const DEV_PORT *Port)
+{
+    if (Port->Spi < DEV_SPI_BUSES && DEV_SpiFreq[Port->Spi] != 0) {
+        return DEV_SpiFreq[Port->Spi];
+    }
+    return Port->SpiFreq;
+}
+
+UBYTE DEV_SPI_SetFreq(UDOUBLE Hz)
+{
+    return DEV_Port_SetFreq(&DEV_DefaultPort, Hz);
+}
+
+UDOUBLE DEV_SPI_GetFreq(void)
+{
+    return DEV_Port_GetFreq(&DEV_DefaultPort);
+}
+
+UBYTE DEV_Port_Init(const DEV_PORT *Port)
 {
     printf("/***********************************/ \r\n");
+#if DEV_SIM
+    DEV_Sim_Attach(Port);
+#endif
     /*spi init*/
-    TUYA_SPI_BASE_CFG_T spi_cfg = {.mode     = TUYA_SPI_MODE0,
-                                   .freq_hz  = SPI_FREQ,
-                                   .databits = TUYA_SPI_DATA_BIT8,
-                                   .bitorder = TUYA_SPI_ORDER_MSB2LSB,
-                                   .role     = TUYA_SPI_ROLE_MASTER,
-                                   .type     = TUYA_SPI_SOFT_ONE_WIRE_TYPE};
-    tkl_spi_init(SPI_ID, &spi_cfg);
+    DEV_SPI_Init(Port);
 
-    DEV_GPIO_Init();
+    DEV_GPIO_Init(Port);
     printf("/***********************************/ \r\n");
     return 0;
 }
 
+void DEV_Port_Exit(const DEV_PORT *Port)
+{
+#if DEV_SIM
+    DEV_Sim_Detach(Port);
+#else
+    tkl_spi_deinit(Port->Spi);
+    tkl_gpio_deinit(Port->Sclk);
+    tkl_gpio_deinit(Port->Mosi);
+    tkl_gpio_deinit(Port->Cs);
+    tkl_gpio_deinit(Port->Dc);
+    tkl_gpio_deinit(Port->Rst);
+    tkl_gpio_deinit(Port->Busy);
+    tkl_gpio_deinit(Port->Pwr);
+#endif
+    if (Port->Spi < DEV_SPI_BUSES) {
+        DEV_SpiUp[Port->Spi] = 0;
+    }
+    DEV_GPIO_Forget(Port->Sclk);
+    DEV_GPIO_Forget(Port->Mosi);
+    DEV_GPIO_Forget(Port->Cs);
+    DEV_GPIO_Forget(Port->Dc);
+    DEV_GPIO_Forget(Port->Rst);
+    DEV_GPIO_Forget(Port->Busy);
+    DEV_GPIO_Forget(Port->Pwr);
+}
+
+UBYTE DEV_Module_Init(void)
+{
+    return DEV_Port_Init(&DEV_DefaultPort);
+}
+
 void DEV_Module_Exit(void)
 {
-    tkl_spi_deinit(SPI_ID);
-    tkl_gpio_deinit(EPD_SCLK_PIN);
-    tkl_gpio_deinit(EPD_MOSI_PIN);
-    tkl_gpio_deinit(EPD_CS_PIN);
-    tkl_gpio_deinit(EPD_DC_PIN);
-    tkl_gpio_deinit(EPD_RST_PIN);
-    tkl_gpio_deinit(EPD_BUSY_PIN);
-    tkl_gpio_deinit(EPD_PWR_PIN);
+    DEV_Port_Exit(&DEV_DefaultPort);
 }
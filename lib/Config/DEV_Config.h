@@ -92,7 +92,60 @@
 #ifndef SPI_ID
 #define SPI_ID TUYA_SPI_NUM_1
 #endif
-#define SPI_FREQ 4 * 1000 * 1000 // 4M
+#define SPI_FREQ 4 * 1000 * 1000 // 4M, default until DEV_Port_SetFreq()
+
+/**
+ * Host simulator: GPIO, SPI and clock go to DEV_Sim instead of the hardware
+ **/
+#ifndef DEV_SIM
+#if OPERATING_SYSTEM == SYSTEM_LINUX
+#define DEV_SIM 1
+#else
+#define DEV_SIM 0
+#endif
+#endif
+
+/**
+ * SPI/GPIO trace hooks (DEV_Trace), idle unless a recording is running.
+ * On with the simulator only; firmware builds opt in with -DDEV_TRACE=1
+ **/
+#ifndef DEV_TRACE
+#define DEV_TRACE DEV_SIM
+#endif
+
+/**
+ * Wiring of one panel: control pins and the SPI bus it hangs on.
+ * Panels on separate buses can be driven from separate threads.
+ **/
+typedef struct {
+    UWORD   Sclk;
+    UWORD   Mosi;
+    UWORD   Cs;
+    UWORD   Dc;
+    UWORD   Rst;
+    UWORD   Busy;
+    UWORD   Pwr;
+    UBYTE   Spi; // TUYA_SPI_NUM_E
+    UDOUBLE SpiFreq; // Default clock, see DEV_Port_SetFreq()
+} DEV_PORT;
+
+// The EPD_*_PIN / SPI_ID wiring from EPD_Config.h
+extern const DEV_PORT DEV_DefaultPort;
+
+/**
+ * One piece of a vectored SPI write, see DEV_SPI_Writev()
+ **/
+typedef struct {
+    const UBYTE *Data;
+    UDOUBLE      Len;
+} DEV_SPI_SEG;
+
+// DC handling of DEV_SPI_Writev()
+#define DEV_SPI_DC_DATA 0 // Every byte is data
+#define DEV_SPI_DC_CMD  1 // First byte is the command, the rest its parameters/data
+
+// Largest single tkl_spi_send(), its length is 16 bit
+#define DEV_SPI_XFER_MAX 0x8000
 
 /*------------------------------------------------------------------------------------------------------*/
 void  DEV_Digital_Write(UWORD Pin, UBYTE Value);
@@ -101,12 +154,27 @@ UBYTE DEV_Digital_Read(UWORD Pin);
 void DEV_SPI_WriteByte(UBYTE Value);
 void DEV_SPI_Write_nByte(uint8_t *pData, uint32_t Len);
 void DEV_Delay_ms(UDOUBLE xms);
+UDOUBLE DEV_Get_ms(void);
+
+void DEV_SPI_Writev(const DEV_SPI_SEG *Segs, UBYTE Count, UBYTE DcMode);
 
 void  DEV_SPI_SendData(UBYTE Reg);
-void  DEV_SPI_SendnData(UBYTE *Reg);
 UBYTE DEV_SPI_ReadData();
+UBYTE DEV_SPI_ReadReg(UBYTE Reg, UBYTE *Buf, UBYTE Len);
 
 UBYTE DEV_Module_Init(void);
 void  DEV_Module_Exit(void);
 
+void  DEV_Port_WriteByte(const DEV_PORT *Port, UBYTE Value);
+void  DEV_Port_Write_nByte(const DEV_PORT *Port, uint8_t *pData, uint32_t Len);
+void  DEV_Port_Writev(const DEV_PORT *Port, const DEV_SPI_SEG *Segs, UBYTE Count, UBYTE DcMode);
+UBYTE DEV_Port_ReadReg(const DEV_PORT *Port, UBYTE Reg, UBYTE *Buf, UBYTE Len);
+UBYTE DEV_Port_Init(const DEV_PORT *Port);
+void  DEV_Port_Exit(const DEV_PORT *Port);
+
+UBYTE   DEV_SPI_SetFreq(UDOUBLE Hz);
+UDOUBLE DEV_SPI_GetFreq(void);
+UBYTE   DEV_Port_SetFreq(const DEV_PORT *Port, UDOUBLE Hz);
+UDOUBLE DEV_Port_GetFreq(const DEV_PORT *Port);
+
 #endif
@@ -0,0 +1,612 @@
+/*****************************************************************************
+ * | File      	:   DEV_Sim.c
+ * | Author      :   e-Paper Album
+ * | Function    :   Host simulator backend of DEV_Config
+ * | Info        :
+ *   Each attached DEV_PORT gets a virtual controller. Pin writes and SPI
+ *   bytes are decoded the way the 4inch e-Paper (E) controller sees them:
+ *   DC low is a command, DC high a parameter of the last command, nothing
+ *   counts while CS is high or RST is held low.
+ *----------------
+ * |	This version:   V1.0
+ * | Date        :   2026-10-16
+ * | Info        :
+ ******************************************************************************/
+#include "DEV_Sim.h"
+
+#if DEV_SIM
+
+#include "Debug.h"
+#include <stdlib.h>
+
+/**
+ * One virtual controller
+ **/
+typedef struct {
+    const DEV_PORT *Port; // NULL: slot free
+    UBYTE           Attached;
+    UBYTE           Rst;
+    UBYTE           Dc;
+    UBYTE           Cs;
+    UBYTE           Cmd;      // Last command, 0xFF after reset
+    UDOUBLE         Idx;      // Parameter bytes received for Cmd
+    UBYTE           Param[4]; // Parameters of short commands
+    UBYTE           Sleeping;
+    UBYTE           Powered;
+    UWORD           Width;
+    UWORD           Height;
+    UBYTE          *Ram;   // Frame RAM loaded with 0x10, 4bpp
+    UBYTE          *Shown; // Frame on the glass
+    UDOUBLE         BusyUntil;
+    DEV_SIM_STATS   Stats;
+} DEV_SIM_PANEL;
+
+const DEV_SIM_CONFIG DEV_SimDefaultConfig = {
+    .Reset_ms    = 20,
+    .PowerOn_ms  = 120,
+    .Refresh_ms  = 15000,
+    .PowerOff_ms = 40,
+    .Speedup     = 1,
+    .SpiTime     = 1,
+    .Temp_C      = 25,
+    .SpiMax_Hz   = 0,
+    .Snapshot    = NULL,
+};
+
+static struct {
+    UBYTE          Started;
+    DEV_SIM_CONFIG Config;
+    MUTEX_HANDLE   Lock;
+    SYS_TIME_T     Base;      // Host tick at start
+    uint64_t       Offset_us; // Simulated time not spent on the host clock
+    DEV_SIM_PANEL  Panel[DEV_SIM_PANELS];
+} Sim;
+
+// Spectra 6 color index -> RGB; 4 and 7 are not used by the panel
+static const UBYTE DEV_SimRgb[8][3] = {
+    {0x00, 0x00, 0x00}, // BLACK
+    {0xFF, 0xFF, 0xFF}, // WHITE
+    {0xFF, 0xFF, 0x00}, // YELLOW
+    {0xFF, 0x00, 0x00}, // RED
+    {0x80, 0x80, 0x80},
+    {0x00, 0x00, 0xFF}, // BLUE
+    {0x00, 0xFF, 0x00}, // GREEN
+    {0xFF, 0xFF, 0xFF},
+};
+
+/**
+ * Read an unsigned number from the environment
+ **/
+static void DEV_Sim_Env(const char *Name, UDOUBLE *Value)
+{
+    const char *s = getenv(Name);
+
+    if (s != NULL && *s != '\0') {
+        *Value = (UDOUBLE)strtoul(s, NULL, 0);
+    }
+}
+
+/**
+ * First use: defaults, EPD_SIM_* environment overrides, lock and clock base
+ **/
+static void DEV_Sim_Start(void)
+{
+    const char *s;
+
+    if (Sim.Started) {
+        return;
+    }
+    Sim.Started = 1;
+    Sim.Config  = DEV_SimDefaultConfig;
+    DEV_Sim_Env("EPD_SIM_SPEEDUP", &Sim.Config.Speedup);
+    DEV_Sim_Env("EPD_SIM_REFRESH_MS", &Sim.Config.Refresh_ms);
+    DEV_Sim_Env("EPD_SIM_SPI_MAX", &Sim.Config.SpiMax_Hz);
+    s = getenv("EPD_SIM_TEMP");
+    if (s != NULL && *s != '\0') {
+        Sim.Config.Temp_C = (int8_t)atoi(s);
+    }
+    s = getenv("EPD_SIM_SNAPSHOT");
+    if (s != NULL && *s != '\0') {
+        Sim.Config.Snapshot = s;
+    }
+    tal_mutex_create_init(&Sim.Lock);
+    Sim.Base = tal_system_get_millisecond();
+}
+
+static void DEV_Sim_Lock(void)
+{
+    DEV_Sim_Start();
+    if (Sim.Lock) {
+        tal_mutex_lock(Sim.Lock);
+    }
+}
+
+static void DEV_Sim_Unlock(void)
+{
+    if (Sim.Lock) {
+        tal_mutex_unlock(Sim.Lock);
+    }
+}
+
+/**
+ * Simulated clock, lock held
+ **/
+static UDOUBLE DEV_Sim_Now(void)
+{
+    UDOUBLE Ms = (UDOUBLE)(Sim.Offset_us / 1000);
+
+    if (Sim.Config.Speedup != 0) {
+        Ms += (UDOUBLE)(tal_system_get_millisecond() - Sim.Base) * Sim.Config.Speedup;
+    }
+    return Ms;
+}
+
+/******************************************************************************
+function :  Replace the timing model
+parameter:
+    Config : New settings, NULL for DEV_SimDefaultConfig
+info:
+    The clock keeps running from its current value.
+******************************************************************************/
+void DEV_Sim_Configure(const DEV_SIM_CONFIG *Config)
+{
+    UDOUBLE Now;
+
+    DEV_Sim_Lock();
+    Now           = DEV_Sim_Now();
+    Sim.Config    = Config ? *Config : DEV_SimDefaultConfig;
+    Sim.Base      = tal_system_get_millisecond();
+    Sim.Offset_us = (uint64_t)Now * 1000;
+    DEV_Sim_Unlock();
+}
+
+/**
+ * Panel of Port, NULL finds a free slot; lock held
+ **/
+static DEV_SIM_PANEL *DEV_Sim_Find(const DEV_PORT *Port)
+{
+    UBYTE i;
+
+    for (i = 0; i < DEV_SIM_PANELS; i++) {
+        if (Sim.Panel[i].Port == Port) {
+            return &Sim.Panel[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * (Re)size the frame buffers, contents become white
+ **/
+static UBYTE DEV_Sim_Resize(DEV_SIM_PANEL *P, UWORD Width, UWORD Height)
+{
+    UDOUBLE Bytes = ((UDOUBLE)Width + 1) / 2 * Height;
+    UBYTE  *Ram   = malloc(Bytes);
+    UBYTE  *Shown = malloc(Bytes);
+
+    if (Ram == NULL || Shown == NULL) {
+        free(Ram);
+        free(Shown);
+        Debug("DEV_Sim: no memory for %u x %u\r\n", Width, Height);
+        return 1;
+    }
+    memset(Ram, 0x11, Bytes);
+    memset(Shown, 0x11, Bytes);
+    free(P->Ram);
+    free(P->Shown);
+    P->Ram    = Ram;
+    P->Shown  = Shown;
+    P->Width  = Width;
+    P->Height = Height;
+    return 0;
+}
+
+static void DEV_Sim_Error(DEV_SIM_PANEL *P, const char *What)
+{
+    P->Stats.Errors++;
+    Debug("DEV_Sim: %s (cmd 0x%02X)\r\n", What, P->Cmd);
+}
+
+static void DEV_Sim_Busy(DEV_SIM_PANEL *P, UDOUBLE Ms)
+{
+    P->BusyUntil = DEV_Sim_Now() + Ms;
+}
+
+/**
+ * Shown frame as a binary PPM, lock held
+ **/
+static UBYTE DEV_Sim_WritePpm(DEV_SIM_PANEL *P, const char *Path)
+{
+    FILE *f = fopen(Path, "wb");
+    UWORD x, y;
+
+    if (f == NULL) {
+        Debug("DEV_Sim: cannot write %s\r\n", Path);
+        return 1;
+    }
+    fprintf(f, "P6\n%u %u\n255\n", P->Width, P->Height);
+    for (y = 0; y < P->Height; y++) {
+        const UBYTE *Row = P->Shown + ((UDOUBLE)P->Width + 1) / 2 * y;
+
+        for (x = 0; x < P->Width; x++) {
+            UBYTE Color = (x & 1) ? Row[x / 2] & 0x07 : (Row[x / 2] >> 4) & 0x07;
+            fwrite(DEV_SimRgb[Color], 1, 3, f);
+        }
+    }
+    if (fclose(f) != 0) {
+        return 1;
+    }
+    Debug("DEV_Sim: snapshot %s\r\n", Path);
+    return 0;
+}
+
+/******************************************************************************
+function :  Connect a virtual panel to Port
+parameter:
+    Port : Pins and SPI of the panel, kept until DEV_Sim_Detach()
+info:
+    A port attached before keeps what its panel shows.
+******************************************************************************/
+void DEV_Sim_Attach(const DEV_PORT *Port)
+{
+    DEV_SIM_PANEL *P;
+
+    DEV_Sim_Lock();
+    P = DEV_Sim_Find(Port);
+    if (P == NULL) {
+        P = DEV_Sim_Find(NULL);
+        if (P == NULL) {
+            DEV_Sim_Unlock();
+            Debug("DEV_Sim: more than %d panels\r\n", DEV_SIM_PANELS);
+            return;
+        }
+        if (DEV_Sim_Resize(P, 400, 600) != 0) {
+            DEV_Sim_Unlock();
+            return;
+        }
+        P->Port = Port;
+    }
+    P->Attached = 1;
+    P->Rst      = 1;
+    P->Cs       = 1;
+    P->Cmd      = 0xFF;
+    DEV_Sim_Unlock();
+}
+
+void DEV_Sim_Detach(const DEV_PORT *Port)
+{
+    DEV_SIM_PANEL *P;
+
+    DEV_Sim_Lock();
+    P = DEV_Sim_Find(Port);
+    if (P != NULL) {
+        P->Attached = 0;
+        P->Powered  = 0;
+    }
+    DEV_Sim_Unlock();
+}
+
+/******************************************************************************
+function :  GPIO write: CS, DC and RST of every attached panel
+parameter:
+******************************************************************************/
+void DEV_Sim_Write(UWORD Pin, UBYTE Value)
+{
+    UBYTE i;
+
+    DEV_Sim_Lock();
+    for (i = 0; i < DEV_SIM_PANELS; i++) {
+        DEV_SIM_PANEL *P = &Sim.Panel[i];
+
+        if (!P->Attached) {
+            continue;
+        }
+        if (Pin == P->Port->Cs) {
+            P->Cs = Value;
+        } else if (Pin == P->Port->Dc) {
+            P->Dc = Value;
+        } else if (Pin == P->Port->Rst) {
+            if (!P->Rst && Value) { // Rising edge ends the reset pulse
+                P->Sleeping = 0;
+                P->Powered  = 0;
+                P->Cmd      = 0xFF;
+                DEV_Sim_Busy(P, Sim.Config.Reset_ms);
+            }
+            P->Rst = Value;
+        }
+    }
+    DEV_Sim_Unlock();
+}
+
+/******************************************************************************
+function :  GPIO read: BUSY is low until the modelled operation is over
+parameter:
+******************************************************************************/
+UBYTE DEV_Sim_Read(UWORD Pin)
+{
+    UBYTE Level = 1;
+    UBYTE i;
+
+    DEV_Sim_Lock();
+    for (i = 0; i < DEV_SIM_PANELS; i++) {
+        DEV_SIM_PANEL *P = &Sim.Panel[i];
+
+        if (P->Attached && Pin == P->Port->Busy && (int32_t)(DEV_Sim_Now() - P->BusyUntil) < 0) {
+            P->Stats.BusyReads++;
+            if (Sim.Config.Speedup == 0) {
+                Sim.Offset_us += 1000; // Polling takes time, also on the virtual clock
+            }
+            Level = 0;
+        }
+    }
+    DEV_Sim_Unlock();
+    return Level;
+}
+
+/**
+ * Controller side of a command byte
+ **/
+static void DEV_Sim_Command(DEV_SIM_PANEL *P, UBYTE Cmd)
+{
+    char Path[256];
+
+    P->Stats.Commands++;
+    P->Stats.LastCmd_ms = DEV_Sim_Now();
+    if (P->Sleeping) {
+        DEV_Sim_Error(P, "command in deep sleep");
+        return;
+    }
+    if ((int32_t)(P->Stats.LastCmd_ms - P->BusyUntil) < 0) {
+        DEV_Sim_Error(P, "command while BUSY");
+    }
+    P->Cmd = Cmd;
+    P->Idx = 0;
+
+    switch (Cmd) {
+    case 0x10: // DATA_START_TRANSMISSION
+        P->Stats.FrameBytes = 0;
+        break;
+    case 0x04: // POWER_ON
+        P->Powered = 1;
+        DEV_Sim_Busy(P, Sim.Config.PowerOn_ms);
+        break;
+    case 0x12: // DISPLAY_REFRESH
+        if (!P->Powered) {
+            DEV_Sim_Error(P, "refresh without POWER_ON");
+        }
+        memcpy(P->Shown, P->Ram, ((UDOUBLE)P->Width + 1) / 2 * P->Height);
+        P->Stats.Refreshes++;
+        DEV_Sim_Busy(P, Sim.Config.Refresh_ms);
+        if (Sim.Config.Snapshot != NULL) {
+            snprintf(Path, sizeof(Path), Sim.Config.Snapshot, P->Stats.Refreshes);
+            DEV_Sim_WritePpm(P, Path);
+        }
+        break;
+    case 0x02: // POWER_OFF
+        P->Powered = 0;
+        DEV_Sim_Busy(P, Sim.Config.PowerOff_ms);
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * Controller side of a parameter byte
+ **/
+static void DEV_Sim_Data(DEV_SIM_PANEL *P, UBYTE Data)
+{
+    UDOUBLE Frame = ((UDOUBLE)P->Width + 1) / 2 * P->Height;
+
+    P->Stats.DataBytes++;
+    if (P->Sleeping) {
+        return;
+    }
+    switch (P->Cmd) {
+    case 0x10:
+        if (P->Idx < Frame) {
+            P->Ram[P->Idx] = Data;
+        } else if (P->Idx == Frame) {
+            DEV_Sim_Error(P, "frame data overflow");
+        }
+        P->Stats.FrameBytes++;
+        break;
+    case 0x61: // TRES: width and height, big endian
+        P->Param[P->Idx] = Data;
+        if (P->Idx == 3) {
+            UWORD Width  = P->Param[0] << 8 | P->Param[1];
+            UWORD Height = P->Param[2] << 8 | P->Param[3];
+
+            if (Width != P->Width || Height != P->Height) {
+                DEV_Sim_Resize(P, Width, Height);
+            }
+        }
+        break;
+    case 0x07: // DEEP_SLEEP
+        if (Data == 0xA5) {
+            P->Sleeping = 1;
+        }
+        break;
+    case 0xFF:
+        DEV_Sim_Error(P, "data without command");
+        break;
+    default:
+        break;
+    }
+    P->Idx++;
+}
+
+/******************************************************************************
+function :  SPI write towards the panel on Port
+parameter:
+    Port  : Bus the bytes go to
+    pData : Bytes
+    Len   : Number of bytes
+******************************************************************************/
+void DEV_Sim_Spi(const DEV_PORT *Port, const UBYTE *pData, UDOUBLE Len)
+{
+    DEV_SIM_PANEL *P;
+    UDOUBLE        i;
+    UBYTE          Flip;
+
+    DEV_Sim_Lock();
+    // A long cable: every byte above the limit loses its lowest bit
+    Flip = (Sim.Config.SpiMax_Hz != 0 && DEV_Port_GetFreq(Port) > Sim.Config.SpiMax_Hz) ? 0x01 : 0x00;
+    if (Sim.Config.SpiTime && DEV_Port_GetFreq(Port) != 0) {
+        Sim.Offset_us += (uint64_t)Len * 8 * 1000000 / DEV_Port_GetFreq(Port);
+    }
+    P = DEV_Sim_Find(Port);
+    if (P == NULL || !P->Attached) {
+        DEV_Sim_Unlock();
+        return;
+    }
+    if (P->Cs || !P->Rst) {
+        DEV_Sim_Error(P, P->Cs ? "SPI with CS high" : "SPI during reset");
+        DEV_Sim_Unlock();
+        return;
+    }
+    for (i = 0; i < Len; i++) {
+        if (P->Dc) {
+            DEV_Sim_Data(P, pData[i] ^ Flip);
+        } else {
+            DEV_Sim_Command(P, pData[i] ^ Flip);
+        }
+    }
+    DEV_Sim_Unlock();
+}
+
+/******************************************************************************
+function :  Register read over 3-wire SPI
+parameter:
+    Port : Panel
+    Reg  : 0x71 status, 0x40 temperature, 0x70 revision
+    Buf  : Receives Len bytes; unknown registers and a missing panel read 0xFF
+info:
+    Status: bit0 BUSY_N, bit1 power off, bit2 power on.
+    Temperature: whole degrees (signed), then 1/8 degrees in bits 7..5.
+******************************************************************************/
+void DEV_Sim_ReadReg(const DEV_PORT *Port, UBYTE Reg, UBYTE *Buf, UBYTE Len)
+{
+    static const UBYTE Rev[] = {'S', 'I', 'M', 0x01};
+    DEV_SIM_PANEL     *P;
+    UBYTE              Resp[sizeof(Rev)];
+    UBYTE              n = 0;
+
+    memset(Buf, 0xFF, Len);
+    DEV_Sim_Lock();
+    P = DEV_Sim_Find(Port);
+    if (P != NULL && P->Attached && P->Rst && !P->Sleeping) {
+        switch (Reg) {
+        case 0x71: // FLG
+            Resp[0] = ((int32_t)(DEV_Sim_Now() - P->BusyUntil) >= 0) | (P->Powered ? 0x04 : 0x02);
+            n       = 1;
+            break;
+        case 0x40: // TSC
+            Resp[0] = (UBYTE)Sim.Config.Temp_C;
+            Resp[1] = 0;
+            n       = 2;
+            break;
+        case 0x70: // REV
+            memcpy(Resp, Rev, sizeof(Rev));
+            n = sizeof(Rev);
+            break;
+        default:
+            break;
+        }
+        memcpy(Buf, Resp, Len < n ? Len : n);
+        P->Stats.Commands++;
+    }
+    DEV_Sim_Unlock();
+}
+
+/******************************************************************************
+function :  Delay on the simulated clock
+parameter:
+info:
+    With Speedup N the host sleeps xms / N; with Speedup 0 only the virtual
+    clock moves.
+******************************************************************************/
+void DEV_Sim_Delay_ms(UDOUBLE xms)
+{
+    UDOUBLE Speedup;
+
+    DEV_Sim_Lock();
+    Speedup = Sim.Config.Speedup;
+    if (Speedup == 0) {
+        Sim.Offset_us += (uint64_t)xms * 1000;
+    } else {
+        Sim.Offset_us += (uint64_t)(xms % Speedup) * 1000;
+    }
+    DEV_Sim_Unlock();
+
+    if (Speedup != 0 && xms / Speedup != 0) {
+        tal_system_sleep(xms / Speedup);
+    }
+}
+
+UDOUBLE DEV_Sim_Get_ms(void)
+{
+    UDOUBLE Ms;
+
+    DEV_Sim_Lock();
+    Ms = DEV_Sim_Now();
+    DEV_Sim_Unlock();
+    return Ms;
+}
+
+/******************************************************************************
+function :  Write what the panel shows as a binary PPM
+parameter:
+    Port : Panel, NULL for DEV_DefaultPort
+    Path : Output file
+return   :  0 written; 1 no such panel or I/O error
+******************************************************************************/
+UBYTE DEV_Sim_Snapshot(const DEV_PORT *Port, const char *Path)
+{
+    DEV_SIM_PANEL *P;
+    UBYTE          Ret = 1;
+
+    DEV_Sim_Lock();
+    P = DEV_Sim_Find(Port ? Port : &DEV_DefaultPort);
+    if (P != NULL && P->Shown != NULL) {
+        Ret = DEV_Sim_WritePpm(P, Path);
+    }
+    DEV_Sim_Unlock();
+    return Ret;
+}
+
+/******************************************************************************
+function :  Color index shown at (X, Y)
+parameter:
+return   :  EPD_4IN0E_* color, 0xFF outside the panel
+******************************************************************************/
+UBYTE DEV_Sim_GetPixel(const DEV_PORT *Port, UWORD X, UWORD Y)
+{
+    DEV_SIM_PANEL *P;
+    UBYTE          Color = 0xFF;
+
+    DEV_Sim_Lock();
+    P = DEV_Sim_Find(Port ? Port : &DEV_DefaultPort);
+    if (P != NULL && P->Shown != NULL && X < P->Width && Y < P->Height) {
+        UBYTE Byte = P->Shown[((UDOUBLE)P->Width + 1) / 2 * Y + X / 2];
+        Color      = (X & 1) ? Byte & 0x0F : Byte >> 4;
+    }
+    DEV_Sim_Unlock();
+    return Color;
+}
+
+void DEV_Sim_GetStats(const DEV_PORT *Port, DEV_SIM_STATS *Stats)
+{
+    DEV_SIM_PANEL *P;
+
+    DEV_Sim_Lock();
+    P = DEV_Sim_Find(Port ? Port : &DEV_DefaultPort);
+    if (P != NULL) {
+        *Stats = P->Stats;
+    } else {
+        memset(Stats, 0, sizeof(*Stats));
+    }
+    DEV_Sim_Unlock();
+}
+
+#endif // DEV_SIM
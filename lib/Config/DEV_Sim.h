@@ -0,0 +1,72 @@
+/*****************************************************************************
+ * | File      	:   DEV_Sim.h
+ * | Author      :   e-Paper Album
+ * | Function    :   Host simulator backend of DEV_Config
+ * | Info        :
+ *   Decodes the command/data stream sent over SPI into a virtual Spectra 6
+ *   panel, drives BUSY from a timing model and writes PPM snapshots of what
+ *   the panel shows. Enabled with DEV_SIM (default on Linux builds).
+ *----------------
+ * |	This version:   V1.0
+ * | Date        :   2026-10-16
+ * | Info        :
+ ******************************************************************************/
+#ifndef _DEV_SIM_H_
+#define _DEV_SIM_H_
+
+#include "DEV_Config.h"
+
+// Panels that can be attached at the same time, one per DEV_PORT
+#ifndef DEV_SIM_PANELS
+#define DEV_SIM_PANELS 2
+#endif
+
+/**
+ * Timing model and clock
+ **/
+typedef struct {
+    UDOUBLE     Reset_ms;    // BUSY low after the reset pulse
+    UDOUBLE     PowerOn_ms;  // BUSY low after POWER_ON (0x04)
+    UDOUBLE     Refresh_ms;  // BUSY low after DISPLAY_REFRESH (0x12)
+    UDOUBLE     PowerOff_ms; // BUSY low after POWER_OFF (0x02)
+    UDOUBLE     Speedup;     // Simulated ms per host ms; 0: virtual clock, delays return at once
+    UBYTE       SpiTime;     // 1: SPI transfers advance the clock at DEV_Port_GetFreq()
+    int8_t      Temp_C;      // Reported by the temperature register
+    UDOUBLE     SpiMax_Hz;   // Bytes sent at a faster clock arrive corrupted, 0: no limit
+    const char *Snapshot;    // printf pattern taking the refresh number, NULL: no automatic snapshots
+} DEV_SIM_CONFIG;
+
+/**
+ * Counters of one panel
+ **/
+typedef struct {
+    UDOUBLE Commands;
+    UDOUBLE DataBytes;
+    UDOUBLE FrameBytes;  // Data bytes of the last 0x10 transfer
+    UDOUBLE Refreshes;
+    UDOUBLE BusyReads;   // DEV_Digital_Read() of BUSY while low
+    UDOUBLE Errors;      // Protocol errors, see the log
+    UDOUBLE LastCmd_ms;  // Clock at the last command
+} DEV_SIM_STATS;
+
+// Timing of the 4inch Spectra 6 panel; Speedup 1 and SPI time on
+extern const DEV_SIM_CONFIG DEV_SimDefaultConfig;
+
+void DEV_Sim_Configure(const DEV_SIM_CONFIG *Config);
+
+// HAL hooks used by DEV_Config.c
+void    DEV_Sim_Attach(const DEV_PORT *Port);
+void    DEV_Sim_Detach(const DEV_PORT *Port);
+void    DEV_Sim_Write(UWORD Pin, UBYTE Value);
+UBYTE   DEV_Sim_Read(UWORD Pin);
+void    DEV_Sim_Spi(const DEV_PORT *Port, const UBYTE *pData, UDOUBLE Len);
+void    DEV_Sim_ReadReg(const DEV_PORT *Port, UBYTE Reg, UBYTE *Buf, UBYTE Len);
+void    DEV_Sim_Delay_ms(UDOUBLE xms);
+UDOUBLE DEV_Sim_Get_ms(void);
+
+// Inspection of the panel on Port, NULL for DEV_DefaultPort
+UBYTE DEV_Sim_Snapshot(const DEV_PORT *Port, const char *Path);
+UBYTE DEV_Sim_GetPixel(const DEV_PORT *Port, UWORD X, UWORD Y);
+void  DEV_Sim_GetStats(const DEV_PORT *Port, DEV_SIM_STATS *Stats);
+
+#endif
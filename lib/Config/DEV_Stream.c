@@ -0,0 +1,133 @@
+/*****************************************************************************
+ * | File      	:   DEV_Stream.c
+ * | Author      :   e-Paper Album
+ * | Function    :   Double-buffered (ping-pong) SPI streaming
+ * | Info        :
+ *   A sender thread owns the SPI while the calling thread fills the other
+ *   chunk buffer. With only one chunk in flight, a buffer is never refilled
+ *   before the sender is done with it.
+ *----------------
+ * |	This version:   V1.0
+ * | Date        :   2026-10-16
+ * | Info        :
+ ******************************************************************************/
+#include "DEV_Stream.h"
+#include "Debug.h"
+
+/**
+ * Sender thread: push every chunk it is handed to the SPI
+ **/
+static void DEV_Stream_Sender(void *arg)
+{
+    DEV_STREAM *Stream = (DEV_STREAM *)arg;
+
+    while (1) {
+        tal_semaphore_wait(Stream->Ready, SEM_WAIT_FOREVER);
+        DEV_Port_Write_nByte(Stream->Port, Stream->Buf[Stream->SendIdx], Stream->Len);
+        tal_semaphore_post(Stream->Done);
+    }
+}
+
+/******************************************************************************
+function :  Create the sender thread
+parameter:
+    Stream : Stream object, kept for the lifetime of the thread
+    Port   : SPI bus the chunks go to, NULL for DEV_DefaultPort
+return   :  0 on success; 1 if the stream falls back to inline sending
+******************************************************************************/
+UBYTE DEV_Stream_Init(DEV_STREAM *Stream, const DEV_PORT *Port)
+{
+    THREAD_CFG_T thrd_param = {2048, 5, "dev_stream_tx"};
+
+    if (Stream->Inited) {
+        return Stream->Async ? 0 : 1;
+    }
+    Stream->Inited = 1;
+    Stream->Port   = Port ? Port : &DEV_DefaultPort;
+
+    Stream->Ready = NULL;
+    Stream->Done  = NULL;
+    if (tal_semaphore_create_init(&Stream->Ready, 0, 1) != OPRT_OK ||
+        tal_semaphore_create_init(&Stream->Done, 0, 1) != OPRT_OK ||
+        tal_thread_create_and_start(&Stream->Thread, NULL, NULL, DEV_Stream_Sender, Stream, &thrd_param) !=
+            OPRT_OK) {
+        Debug("DEV_Stream: sender thread unavailable, sending inline\r\n");
+        // Inline sending needs neither semaphore
+        if (Stream->Ready != NULL) {
+            tal_semaphore_release(Stream->Ready);
+            Stream->Ready = NULL;
+        }
+        if (Stream->Done != NULL) {
+            tal_semaphore_release(Stream->Done);
+            Stream->Done = NULL;
+        }
+        return 1;
+    }
+    Stream->Async = 1;
+    return 0;
+}
+
+/******************************************************************************
+function :  Stream Total bytes produced by Fill to the SPI
+parameter:
+    Stream : Stream object
+    Fill   : Produces the next chunk
+    Arg    : Passed to Fill
+    Total  : Number of bytes to stream
+return   :  Number of bytes sent
+info:
+    CS/DC are left to the caller, the stream only moves the payload.
+******************************************************************************/
+UDOUBLE DEV_Stream_Run(DEV_STREAM *Stream, DEV_STREAM_FILL Fill, void *Arg, UDOUBLE Total)
+{
+    UDOUBLE Produced = 0, Len, t;
+    UBYTE   Idx      = 0;
+    UBYTE   InFlight = 0;
+
+    Stream->Stats.Bytes   = 0;
+    Stream->Stats.Chunks  = 0;
+    Stream->Stats.Fill_ms = 0;
+    Stream->Stats.Wait_ms = 0;
+
+    while (Produced < Total) {
+        Len = Total - Produced;
+        if (Len > DEV_STREAM_CHUNK) {
+            Len = DEV_STREAM_CHUNK;
+        }
+
+        // Fill the free buffer while the other one is on the wire
+        t   = DEV_Get_ms();
+        Len = Fill(Stream->Buf[Idx], Len, Produced, Arg);
+        Stream->Stats.Fill_ms += DEV_Get_ms() - t;
+        if (Len == 0) {
+            break;
+        }
+
+        if (!Stream->Async) {
+            DEV_Port_Write_nByte(Stream->Port, Stream->Buf[Idx], Len);
+        } else {
+            if (InFlight) {
+                t = DEV_Get_ms();
+                tal_semaphore_wait(Stream->Done, SEM_WAIT_FOREVER);
+                Stream->Stats.Wait_ms += DEV_Get_ms() - t;
+            }
+            Stream->SendIdx = Idx;
+            Stream->Len     = Len;
+            tal_semaphore_post(Stream->Ready);
+            InFlight = 1;
+        }
+
+        Produced += Len;
+        Stream->Stats.Chunks++;
+        Idx ^= 1;
+    }
+
+    if (InFlight) {
+        t = DEV_Get_ms();
+        tal_semaphore_wait(Stream->Done, SEM_WAIT_FOREVER);
+        Stream->Stats.Wait_ms += DEV_Get_ms() - t;
+    }
+
+    Stream->Stats.Bytes = Produced;
+    return Produced;
+}
@@ -0,0 +1,61 @@
+/*****************************************************************************
+ * | File      	:   DEV_Stream.h
+ * | Author      :   e-Paper Album
+ * | Function    :   Double-buffered (ping-pong) SPI streaming
+ * | Info        :
+ *   One chunk is on the wire while the caller prepares the next one, so any
+ *   per-pixel work done while filling overlaps with the SPI transfer.
+ *----------------
+ * |	This version:   V1.0
+ * | Date        :   2026-10-16
+ * | Info        :
+ ******************************************************************************/
+#ifndef _DEV_STREAM_H_
+#define _DEV_STREAM_H_
+
+#include "DEV_Config.h"
+
+/**
+ * Size of each of the two chunk buffers
+ **/
+#ifndef DEV_STREAM_CHUNK
+#define DEV_STREAM_CHUNK 2048
+#endif
+
+/**
+ * Fill callback
+ *   Buf    : chunk buffer to fill
+ *   Size   : capacity of Buf, never more than the bytes still expected
+ *   Offset : number of bytes produced so far
+ *   Arg    : user argument
+ * return   : bytes written to Buf, 0 ends the stream early
+ **/
+typedef UDOUBLE (*DEV_STREAM_FILL)(UBYTE *Buf, UDOUBLE Size, UDOUBLE Offset, void *Arg);
+
+/**
+ * Statistics of the last run
+ **/
+typedef struct {
+    UDOUBLE Bytes;   // Bytes sent
+    UDOUBLE Chunks;  // Chunks sent
+    UDOUBLE Fill_ms; // Time spent in the fill callback
+    UDOUBLE Wait_ms; // Time the caller waited for the SPI to drain
+} DEV_STREAM_STATS;
+
+typedef struct {
+    UBYTE            Buf[2][DEV_STREAM_CHUNK];
+    const DEV_PORT  *Port;    // SPI bus the chunks go to
+    UDOUBLE          Len;     // Length of the chunk handed to the sender
+    UBYTE            SendIdx; // Index of the chunk handed to the sender
+    SEM_HANDLE       Ready;   // Posted by the caller: chunk ready to send
+    SEM_HANDLE       Done;    // Posted by the sender: chunk on the wire
+    THREAD_HANDLE    Thread;
+    UBYTE            Inited;
+    UBYTE            Async; // 0: sender thread unavailable, send inline
+    DEV_STREAM_STATS Stats;
+} DEV_STREAM;
+
+UBYTE   DEV_Stream_Init(DEV_STREAM *Stream, const DEV_PORT *Port);
+UDOUBLE DEV_Stream_Run(DEV_STREAM *Stream, DEV_STREAM_FILL Fill, void *Arg, UDOUBLE Total);
+
+#endif
@@ -0,0 +1,401 @@
+/*****************************************************************************
+ * | File      	:   DEV_Trace.c
+ * | Author      :   e-Paper Album
+ * | Function    :   SPI/GPIO transaction recorder and replay
+ * | Info        :
+ *   The recorder only appends to memory, so it can run on the board; the
+ *   buffer is then dumped, analysed on the spot or replayed into DEV_Sim.
+ *----------------
+ * |	This version:   V1.0
+ * | Date        :   2026-10-16
+ * | Info        :
+ ******************************************************************************/
+#include "DEV_Trace.h"
+#include "Debug.h"
+#if DEV_SIM
+#include "DEV_Sim.h"
+#endif
+
+#define DEV_TRACE_MAGIC     "EPDT"
+#define DEV_TRACE_VERSION   0x01
+#define DEV_TRACE_HEADER    5
+#define DEV_TRACE_TAG_END   0x00 // Recording ran out of buffer
+#define DEV_TRACE_TAG_SPI   0x10
+#define DEV_TRACE_TAG_TIME  0x20
+#define DEV_TRACE_TAG_PIN   0x80
+#define DEV_TRACE_PINS      64
+
+/**
+ * Recorder state
+ **/
+static struct {
+    UBYTE  *Buf;
+    UDOUBLE Size;
+    UDOUBLE Used;
+    UDOUBLE Last_ms;
+    UBYTE   On;
+} Rec;
+
+/**
+ * One decoded event
+ **/
+typedef struct {
+    UBYTE        Tag; // DEV_TRACE_TAG_SPI or DEV_TRACE_TAG_PIN
+    UBYTE        Pin;
+    UBYTE        Value;
+    UBYTE        Bus;
+    const UBYTE *Data;
+    UDOUBLE      Len;
+    UDOUBLE      Time; // ms since the start of the trace
+} DEV_TRACE_EVENT;
+
+typedef struct {
+    const UBYTE *Trace;
+    UDOUBLE      Len;
+    UDOUBLE      Pos;
+    UDOUBLE      Time;
+    UBYTE        Truncated;
+} DEV_TRACE_CURSOR;
+
+/**
+ * Append Len bytes, or end the recording when they do not fit.
+ * One byte is always kept for the end tag.
+ **/
+static UBYTE DEV_Trace_Put(const UBYTE *Data, UDOUBLE Len)
+{
+    if (Rec.Used + Len + 1 > Rec.Size) {
+        Rec.Buf[Rec.Used++] = DEV_TRACE_TAG_END;
+        Rec.On              = 0;
+        return 1;
+    }
+    memcpy(Rec.Buf + Rec.Used, Data, Len);
+    Rec.Used += Len;
+    return 0;
+}
+
+static UBYTE DEV_Trace_PutVarint(UBYTE *Out, UDOUBLE Value)
+{
+    UBYTE n = 0;
+
+    while (Value >= 0x80) {
+        Out[n++] = (Value & 0x7F) | 0x80;
+        Value >>= 7;
+    }
+    Out[n++] = Value;
+    return n;
+}
+
+/**
+ * Time tag for the clock advance since the last event
+ **/
+static UBYTE DEV_Trace_Stamp(void)
+{
+    UBYTE   Tag[6];
+    UDOUBLE Now   = DEV_Get_ms();
+    UDOUBLE Delta = Now - Rec.Last_ms;
+
+    if (Delta == 0) {
+        return 0;
+    }
+    Rec.Last_ms = Now;
+    Tag[0]      = DEV_TRACE_TAG_TIME;
+    return DEV_Trace_Put(Tag, 1 + DEV_Trace_PutVarint(Tag + 1, Delta));
+}
+
+/******************************************************************************
+function :  Start recording into Buf
+parameter:
+    Buf  : Trace buffer, owned by the recorder until DEV_Trace_Stop()
+    Size : Capacity; recording ends early when it is full
+return   :  0 recording; 1 buffer too small
+******************************************************************************/
+UBYTE DEV_Trace_Start(UBYTE *Buf, UDOUBLE Size)
+{
+    if (Size < DEV_TRACE_HEADER + 1) {
+        return 1;
+    }
+    memcpy(Buf, DEV_TRACE_MAGIC, 4);
+    Buf[4]      = DEV_TRACE_VERSION;
+    Rec.Buf     = Buf;
+    Rec.Size    = Size;
+    Rec.Used    = DEV_TRACE_HEADER;
+    Rec.Last_ms = DEV_Get_ms();
+    Rec.On      = 1;
+    return 0;
+}
+
+/******************************************************************************
+function :  Stop recording
+parameter:
+return   :  Length of the trace in the buffer
+******************************************************************************/
+UDOUBLE DEV_Trace_Stop(void)
+{
+    if (Rec.On) {
+        DEV_Trace_Stamp(); // Keep the wait after the last event
+    }
+    Rec.On = 0;
+    return Rec.Buf ? Rec.Used : 0;
+}
+
+/**
+ * Hook of DEV_Digital_Write()
+ **/
+void DEV_Trace_Pin(UWORD Pin, UBYTE Value)
+{
+    UBYTE Tag;
+
+    if (!Rec.On || Pin >= DEV_TRACE_PINS || DEV_Trace_Stamp() != 0) {
+        return;
+    }
+    Tag = DEV_TRACE_TAG_PIN | (Value ? 0x40 : 0) | Pin;
+    DEV_Trace_Put(&Tag, 1);
+}
+
+/**
+ * Hook of the SPI writes
+ **/
+void DEV_Trace_Spi(UBYTE Bus, const UBYTE *pData, UDOUBLE Len)
+{
+    UBYTE Tag[6];
+
+    if (!Rec.On || DEV_Trace_Stamp() != 0) {
+        return;
+    }
+    Tag[0] = DEV_TRACE_TAG_SPI | (Bus & 0x0F);
+    if (DEV_Trace_Put(Tag, 1 + DEV_Trace_PutVarint(Tag + 1, Len)) == 0) {
+        DEV_Trace_Put(pData, Len);
+    }
+}
+
+/**
+ * Varint at the cursor
+ **/
+static UBYTE DEV_Trace_GetVarint(DEV_TRACE_CURSOR *C, UDOUBLE *Value)
+{
+    UBYTE Shift = 0;
+
+    *Value = 0;
+    while (C->Pos < C->Len && Shift < 32) {
+        UBYTE b = C->Trace[C->Pos++];
+
+        *Value |= (UDOUBLE)(b & 0x7F) << Shift;
+        if (!(b & 0x80)) {
+            return 0;
+        }
+        Shift += 7;
+    }
+    return 1;
+}
+
+/**
+ * Next pin or SPI event
+ * return: 0 event; 1 end of trace; 2 malformed
+ **/
+static UBYTE DEV_Trace_Next(DEV_TRACE_CURSOR *C, DEV_TRACE_EVENT *Ev)
+{
+    UDOUBLE Delta;
+
+    if (C->Pos == 0) {
+        if (C->Len < DEV_TRACE_HEADER || memcmp(C->Trace, DEV_TRACE_MAGIC, 4) != 0 ||
+            C->Trace[4] != DEV_TRACE_VERSION) {
+            return 2;
+        }
+        C->Pos = DEV_TRACE_HEADER;
+    }
+
+    while (C->Pos < C->Len) {
+        UBYTE Tag = C->Trace[C->Pos++];
+
+        if (Tag & DEV_TRACE_TAG_PIN) {
+            Ev->Tag   = DEV_TRACE_TAG_PIN;
+            Ev->Pin   = Tag & 0x3F;
+            Ev->Value = (Tag >> 6) & 0x01;
+            Ev->Time  = C->Time;
+            return 0;
+        }
+        if (Tag == DEV_TRACE_TAG_TIME) {
+            if (DEV_Trace_GetVarint(C, &Delta) != 0) {
+                return 2;
+            }
+            C->Time += Delta;
+        } else if ((Tag & 0xF0) == DEV_TRACE_TAG_SPI) {
+            if (DEV_Trace_GetVarint(C, &Ev->Len) != 0 || Ev->Len > C->Len - C->Pos) {
+                return 2;
+            }
+            Ev->Tag  = DEV_TRACE_TAG_SPI;
+            Ev->Bus  = Tag & 0x0F;
+            Ev->Data = C->Trace + C->Pos;
+            Ev->Time = C->Time;
+            C->Pos += Ev->Len;
+            return 0;
+        } else if (Tag == DEV_TRACE_TAG_END) {
+            C->Truncated = 1;
+            return 1;
+        } else {
+            return 2;
+        }
+    }
+    return 1;
+}
+
+/**
+ * Fold a value into the command fingerprint (FNV-1a)
+ **/
+static UDOUBLE DEV_Trace_Fold(UDOUBLE Sum, UDOUBLE Value, UBYTE Bytes)
+{
+    while (Bytes--) {
+        Sum = (Sum ^ (Value & 0xFF)) * 16777619u;
+        Value >>= 8;
+    }
+    return Sum;
+}
+
+/**
+ * Walk a trace, counting; with Print, log each command as it completes
+ **/
+static UBYTE DEV_Trace_Walk(const UBYTE *Trace, UDOUBLE Len, const DEV_PORT *Port, DEV_TRACE_STATS *Stats,
+                            UBYTE Print)
+{
+    DEV_TRACE_CURSOR C  = {Trace, Len, 0, 0, 0};
+    DEV_TRACE_EVENT  Ev = {0};
+    UBYTE            Level[DEV_TRACE_PINS];
+    UDOUBLE          Params  = 0;
+    UDOUBLE          CmdTime = 0;
+    int              Cmd     = -1;
+    UDOUBLE          i;
+    UBYTE            Ret;
+
+    if (Port == NULL) {
+        Port = &DEV_DefaultPort;
+    }
+    memset(Stats, 0, sizeof(*Stats));
+    memset(Level, 0xFF, sizeof(Level)); // Unknown until first written
+    Stats->CmdSum = 2166136261u;
+
+    while ((Ret = DEV_Trace_Next(&C, &Ev)) == 0) {
+        if (Ev.Tag == DEV_TRACE_TAG_PIN) {
+            Stats->PinWrites++;
+            if (Level[Ev.Pin] != 0xFF && Level[Ev.Pin] != Ev.Value) {
+                Stats->Toggles++;
+            }
+            if (Ev.Pin == Port->Cs && !Ev.Value && Level[Ev.Pin] != 0) {
+                Stats->Transactions++;
+            }
+            if (Print && Ev.Pin == Port->Rst && !Ev.Value && Level[Ev.Pin] != 0) {
+                Debug("%8u ms  RST\r\n", Ev.Time);
+            }
+            Level[Ev.Pin] = Ev.Value;
+            continue;
+        }
+
+        Stats->SpiCalls++;
+        if (Level[Port->Dc & 0x3F] == 1) {
+            Stats->DataBytes += Ev.Len;
+            Params += Ev.Len;
+            continue;
+        }
+        for (i = 0; i < Ev.Len; i++) { // Commands, one per byte
+            if (Cmd >= 0) {
+                Stats->CmdSum = DEV_Trace_Fold(Stats->CmdSum, Params, 4);
+                if (Print) {
+                    Debug("%8u ms  CMD 0x%02X  %u data bytes\r\n", CmdTime, Cmd, Params);
+                }
+            }
+            Cmd           = Ev.Data[i];
+            CmdTime       = Ev.Time;
+            Params        = 0;
+            Stats->CmdSum = DEV_Trace_Fold(Stats->CmdSum, Cmd, 1);
+            Stats->Commands++;
+        }
+    }
+    if (Cmd >= 0) {
+        Stats->CmdSum = DEV_Trace_Fold(Stats->CmdSum, Params, 4);
+        if (Print) {
+            Debug("%8u ms  CMD 0x%02X  %u data bytes\r\n", CmdTime, Cmd, Params);
+        }
+    }
+    Stats->Duration_ms = C.Time;
+    Stats->Truncated   = C.Truncated;
+    return Ret == 2 ? 1 : 0;
+}
+
+/******************************************************************************
+function :  Count the byte-level cost of a trace
+parameter:
+    Trace : Recorded trace
+    Len   : Its length
+    Port  : Pins the trace was recorded on, NULL for DEV_DefaultPort
+    Stats : Receives the counters
+return   :  0 ok; 1 malformed trace (Stats cover the part before the error)
+info:
+    Two traces with the same CmdSum sent the same commands with the same
+    number of parameter bytes, whatever the burst sizes.
+******************************************************************************/
+UBYTE DEV_Trace_Analyze(const UBYTE *Trace, UDOUBLE Len, const DEV_PORT *Port, DEV_TRACE_STATS *Stats)
+{
+    return DEV_Trace_Walk(Trace, Len, Port, Stats, 0);
+}
+
+/******************************************************************************
+function :  Log the command sequence of a trace, one line per command
+parameter:
+******************************************************************************/
+void DEV_Trace_Print(const UBYTE *Trace, UDOUBLE Len, const DEV_PORT *Port)
+{
+    DEV_TRACE_STATS Stats;
+
+    if (DEV_Trace_Walk(Trace, Len, Port, &Stats, 1) != 0) {
+        Debug("trace malformed\r\n");
+    }
+    Debug("%u transactions, %u SPI calls, %u commands, %u data bytes, %u/%u pin writes/toggles, %u ms%s\r\n",
+          Stats.Transactions, Stats.SpiCalls, Stats.Commands, Stats.DataBytes, Stats.PinWrites, Stats.Toggles,
+          Stats.Duration_ms, Stats.Truncated ? ", truncated" : "");
+}
+
+/******************************************************************************
+function :  Replay a trace into the simulated panel
+parameter:
+    Trace : Recorded trace
+    Len   : Its length
+    Port  : Panel the trace was recorded on, attached with DEV_Port_Init()
+return   :  0 replayed; 1 malformed trace or no simulator in this build
+info:
+    The gaps between events are kept on the simulated clock, so the
+    panel model sees the same BUSY waits; its DEV_Sim_GetStats() tell
+    whether the sequence was valid.
+******************************************************************************/
+UBYTE DEV_Trace_Replay(const UBYTE *Trace, UDOUBLE Len, const DEV_PORT *Port)
+{
+#if DEV_SIM
+    DEV_TRACE_CURSOR C    = {Trace, Len, 0, 0, 0};
+    DEV_TRACE_EVENT  Ev   = {0};
+    UDOUBLE          Time = 0;
+    UBYTE            Ret;
+
+    if (Port == NULL) {
+        Port = &DEV_DefaultPort;
+    }
+    while ((Ret = DEV_Trace_Next(&C, &Ev)) == 0) {
+        if (Ev.Time != Time) {
+            DEV_Sim_Delay_ms(Ev.Time - Time);
+            Time = Ev.Time;
+        }
+        if (Ev.Tag == DEV_TRACE_TAG_PIN) {
+            DEV_Sim_Write(Ev.Pin, Ev.Value);
+        } else {
+            DEV_Sim_Spi(Port, Ev.Data, Ev.Len);
+        }
+    }
+    if (C.Time != Time) { // Wait recorded after the last event
+        DEV_Sim_Delay_ms(C.Time - Time);
+    }
+    return Ret == 2 ? 1 : 0;
+#else
+    (void)Trace;
+    (void)Len;
+    (void)Port;
+    Debug("trace replay needs DEV_SIM\r\n");
+    return 1;
+#endif
+}
@@ -0,0 +1,54 @@
+/*****************************************************************************
+ * | File      	:   DEV_Trace.h
+ * | Author      :   e-Paper Album
+ * | Function    :   SPI/GPIO transaction recorder and replay
+ * | Info        :
+ *   Records every DEV_Digital_Write() and SPI write with a millisecond time
+ *   stamp into a caller-supplied buffer, in a compact binary format:
+ *     "EPDT" 0x01                   header
+ *     0x80 | Value << 6 | Pin       pin write (Pin < 64)
+ *     0x10 | Bus, varint Len, bytes SPI write
+ *     0x20, varint Delta            clock advanced by Delta ms
+ *   Varints are 7 bits per byte, least significant first.
+ *   There is one recorder for the whole program and it takes no lock: record
+ *   only while a single thread drives the panels, whichever port they are on.
+ *   The hooks are compiled in with DEV_TRACE (default: DEV_SIM builds).
+ *----------------
+ * |	This version:   V1.0
+ * | Date        :   2026-10-16
+ * | Info        :
+ ******************************************************************************/
+#ifndef _DEV_TRACE_H_
+#define _DEV_TRACE_H_
+
+#include "DEV_Config.h"
+
+/**
+ * Byte-level cost of a trace
+ **/
+typedef struct {
+    UDOUBLE Transactions; // CS low periods
+    UDOUBLE SpiCalls;     // DEV_*_WriteByte / Write_nByte calls
+    UDOUBLE Commands;     // Bytes sent with DC low
+    UDOUBLE DataBytes;    // Bytes sent with DC high
+    UDOUBLE PinWrites;    // DEV_Digital_Write() calls
+    UDOUBLE Toggles;      // Pin writes that changed the level
+    UDOUBLE Duration_ms;  // First to last event
+    UDOUBLE CmdSum;       // Fingerprint of the command sequence and parameter counts
+    UBYTE   Truncated;    // Recording ran out of buffer
+} DEV_TRACE_STATS;
+
+// Recorder: hooked into DEV_Config, no cost while stopped, single thread only
+UBYTE   DEV_Trace_Start(UBYTE *Buf, UDOUBLE Size);
+UDOUBLE DEV_Trace_Stop(void);
+void    DEV_Trace_Pin(UWORD Pin, UBYTE Value);
+void    DEV_Trace_Spi(UBYTE Bus, const UBYTE *pData, UDOUBLE Len);
+
+// Offline analysis of a recorded trace
+UBYTE DEV_Trace_Analyze(const UBYTE *Trace, UDOUBLE Len, const DEV_PORT *Port, DEV_TRACE_STATS *Stats);
+void  DEV_Trace_Print(const UBYTE *Trace, UDOUBLE Len, const DEV_PORT *Port);
+
+// Feed a trace into the simulated panel on Port (DEV_SIM builds only)
+UBYTE DEV_Trace_Replay(const UBYTE *Trace, UDOUBLE Len, const DEV_PORT *Port);
+
+#endif
@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+CN 字体码位索引与紧凑字模生成器
+
+读取 fontXXCN.c 中的 CH_CN 字模表, 生成 fontXXCN_index.h:
+- XXX_Index:  按 Unicode 码位排序的索引, 供 Paint_DrawString_CN() 二分查找
+- XXX_Glyphs: 与索引一一对应的紧凑字模描述 (墨迹包围盒与位图偏移)
+- XXX_Bitmap: 只保存包围盒内的点阵, 每行 (w + 7) / 8 字节
+同一字符出现多次时保留表中第一个, 与原先的线性查找一致。
+
+使用方法:
+    python3 cn_index.py font12CN.c font24CN.c
+    python3 cn_index.py --check font*CN.c    # 生成结果过期时返回 1
+
+CMake 配置时会自动运行, 修改字模表后无需手动执行。
+"""
+
+import os
+import re
+import sys
+
+TABLE_RE = re.compile(r'const\s+CH_CN\s+(\w+)_Table\s*\[\]\s*=\s*\{(.*?)\};', re.S)
+ENTRY_RE = re.compile(r'\{\{"((?:[^"\\]|\\.)*)"\},\s*\{([^}]*)\}\}')
+SIZE_RE = re.compile(r'(\d+)\s*,\s*/\*\s*(ASCII Width|Width|Height)\s*\*/')
+
+HEADER = """\
+/* Generated by cn_index.py from {src}, do not edit */
+#ifndef __{guard}_INDEX_H
+#define __{guard}_INDEX_H
+
+#include "fonts.h"
+
+/* {count} code points of {name}_Table, ascending */
+static const CN_INDEX {name}_Index[] = {{
+{rows}
+}};
+
+/* Ink box of each indexed glyph in the {width} x {height} cell: {packed} bytes instead of {full} */
+static const CN_GLYPH {name}_Glyphs[] = {{
+{glyphs}
+}};
+
+static const uint8_t {name}_Bitmap[] = {{
+{bitmap}
+}};
+
+#endif
+"""
+
+
+def unescape(s):
+    """字模表中的 C 字符串转为 UTF-8 字节"""
+    return re.sub(r'\\(.)', r'\1', s).encode('utf-8')
+
+
+def pack(matrix, width, height):
+    """裁掉空白边, 返回 (x, y, w, h, bytes)"""
+    stride = (width + 7) // 8
+    matrix = matrix + [0] * (stride * height - len(matrix))
+    ink = [(i, j) for j in range(height) for i in range(width)
+           if matrix[j * stride + i // 8] & (0x80 >> (i % 8))]
+    if not ink:
+        return 0, 0, 0, 0, []
+    x0, x1 = min(i for i, _ in ink), max(i for i, _ in ink)
+    y0, y1 = min(j for _, j in ink), max(j for _, j in ink)
+    w, h = x1 - x0 + 1, y1 - y0 + 1
+    rows = [[0] * ((w + 7) // 8) for _ in range(h)]
+    for i, j in ink:
+        rows[j - y0][(i - x0) // 8] |= 0x80 >> ((i - x0) % 8)
+    return x0, y0, w, h, [b for r in rows for b in r]
+
+
+def load(path):
+    """返回 (名称, ASCII 宽, 宽, 高, 按码位排序的 (码位, 表项, x, y, w, h, 位图偏移), 位图)"""
+    with open(path, encoding='utf-8') as f:
+        src = f.read()
+    m = TABLE_RE.search(src)
+    if m is None:
+        raise SystemExit('%s: no CH_CN table' % path)
+    name, body = m.group(1), m.group(2)
+    size = dict((k, int(v)) for v, k in SIZE_RE.findall(src[m.end():]))
+    width, height = size['Width'], size['Height']
+
+    codes = {}
+    for glyph, (key, data) in enumerate(ENTRY_RE.findall(body)):
+        text = unescape(key).decode('utf-8')
+        if len(text) != 1:
+            raise SystemExit('%s: entry %d is not one character: %r' % (path, glyph, text))
+        if ord(text) not in codes:  # 第一个优先
+            codes[ord(text)] = (glyph, [int(b, 16) for b in re.findall(r'0x[0-9A-Fa-f]+', data)])
+
+    entries, bitmap = [], []
+    for c in sorted(codes):
+        glyph, matrix = codes[c]
+        x, y, w, h, bits = pack(matrix, width, height)
+        entries.append((c, glyph, x, y, w, h, len(bitmap)))
+        bitmap.extend(bits)
+    return name, size['ASCII Width'], width, height, entries, bitmap
+
+
+def build(path):
+    name, _, width, height, entries, bitmap = load(path)
+    rows, glyphs = [], []
+    for c, glyph, x, y, w, h, offset in entries:
+        rows.append('    {0x%05X, %3d}, /* %s */' % (c, glyph, chr(c)))
+        glyphs.append('    {%5d, %2d, %2d, %2d, %2d}, /* %s */' % (offset, x, y, w, h, chr(c)))
+    lines = ['    ' + ' '.join('0x%02X,' % b for b in bitmap[i:i + 16]) for i in range(0, len(bitmap), 16)]
+
+    out = os.path.join(os.path.dirname(path), os.path.basename(path)[:-2] + '_index.h')
+    return out, HEADER.format(src=os.path.basename(path), guard=name.upper(), name=name, count=len(entries),
+                              rows='\n'.join(rows), width=width, height=height, packed=len(bitmap),
+                              full=len(entries) * 164, glyphs='\n'.join(glyphs), bitmap='\n'.join(lines) or '    0')
+
+
+def main(argv):
+    check = '--check' in argv
+    stale = 0
+    for path in [a for a in argv if a != '--check']:
+        out, text = build(path)
+        old = None
+        if os.path.exists(out):
+            with open(out, encoding='utf-8') as f:
+                old = f.read()
+        if old == text:
+            continue
+        stale = 1
+        if check:
+            print('%s is out of date' % out)
+        else:
+            with open(out, 'w', encoding='utf-8') as f:
+                f.write(text)
+            print('wrote %s' % out)
+    return stale if check else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
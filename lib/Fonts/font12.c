@@ -37,11 +37,13 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
+#include "font12_packed.h"
 
 //
 //  Font data for Courier New 12pt
 //
 
+#if FONT_BUILTIN && !FONT_ASCII_PACKED // Source of the packed glyphs, see font_pack.py
 const uint8_t Font12_Table[] = {
     // @0 ' ' (7 pixels wide)
     0x00, //
@@ -1373,11 +1375,20 @@ const uint8_t Font12_Table[] = {
     0x00, //
     0x00, //
 };
+#endif
 
 sFONT Font12 = {
+#if FONT_BUILTIN && !FONT_ASCII_PACKED
     Font12_Table,
+#else
+    NULL,
+#endif
     7,  /* Width */
     12, /* Height */
+#if FONT_BUILTIN && FONT_ASCII_PACKED
+    Font12_Packed,
+    Font12_Offsets,
+#endif
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -37,11 +37,13 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
+#include "font12CN_index.h"
 
 //
 //  Font data for Courier New 12pt
 //
 
+#if FONT_BUILTIN && !FONT_CN_PACKED // Source of the packed glyphs, see cn_index.py
 const CH_CN Font12CN_Table[] = {
     /*--  文字:  你  --*/
     /*--  微软雅黑12;  此字体下对应的点阵为：宽x高=16x21   --*/
@@ -96,13 +98,33 @@ const CH_CN Font12CN_Table[] = {
     {{"A"}, {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x1F, 0x00,
              0x1F, 0x00, 0x1F, 0x00, 0x3B, 0x80, 0x3B, 0x80, 0x71, 0x80, 0x7F, 0xC0, 0x71, 0xC0,
              0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}}};
+#endif
 
 cFONT Font12CN = {
+#if FONT_BUILTIN && !FONT_CN_PACKED
     Font12CN_Table,
-    sizeof(Font12CN_Table) / sizeof(CH_CN), /*size of table*/
-    11,                                     /* ASCII Width */
-    16,                                     /* Width */
-    21,                                     /* Height */
+    sizeof(Font12CN_Table) / sizeof(CH_CN),    /*size of table*/
+#else
+    NULL,
+    0,
+#endif
+    11,                                        /* ASCII Width */
+    16,                                        /* Width */
+    21,                                        /* Height */
+#if FONT_BUILTIN
+    Font12CN_Index,
+    sizeof(Font12CN_Index) / sizeof(CN_INDEX), /*size of index*/
+#else
+    NULL,
+    0,
+#endif
+#if FONT_BUILTIN && FONT_CN_PACKED
+    Font12CN_Glyphs,
+    Font12CN_Bitmap,
+#else
+    NULL,
+    NULL,
+#endif
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,51 @@
+/* Generated by cn_index.py from font12CN.c, do not edit */
+#ifndef __FONT12CN_INDEX_H
+#define __FONT12CN_INDEX_H
+
+#include "fonts.h"
+
+/* 9 code points of Font12CN_Table, ascending */
+static const CN_INDEX Font12CN_Index[] = {
+    {0x00041,   8}, /* A */
+    {0x00061,   5}, /* a */
+    {0x00062,   6}, /* b */
+    {0x00063,   7}, /* c */
+    {0x04F60,   0}, /* 你 */
+    {0x0597D,   1}, /* 好 */
+    {0x06811,   2}, /* 树 */
+    {0x06D3E,   4}, /* 派 */
+    {0x08393,   3}, /* 莓 */
+};
+
+/* Ink box of each indexed glyph in the 16 x 21 cell: 225 bytes instead of 1476 */
+static const CN_GLYPH Font12CN_Glyphs[] = {
+    {    0,  0,  5, 11, 12}, /* A */
+    {   24,  0,  8,  9,  9}, /* a */
+    {   42,  1,  4,  9, 13}, /* b */
+    {   68,  0,  8,  8,  9}, /* c */
+    {   77,  0,  4, 16, 15}, /* 你 */
+    {  107,  0,  4, 16, 15}, /* 好 */
+    {  137,  0,  4, 16, 15}, /* 树 */
+    {  167,  0,  4, 16, 14}, /* 派 */
+    {  195,  0,  4, 16, 15}, /* 莓 */
+};
+
+static const uint8_t Font12CN_Bitmap[] = {
+    0x0E, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x3B, 0x80, 0x3B, 0x80, 0x71, 0x80, 0x7F, 0xC0,
+    0x71, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x3E, 0x00, 0x67, 0x00, 0x07, 0x80, 0x0F, 0x80,
+    0x7F, 0x80, 0xE3, 0x80, 0xE7, 0x80, 0xE7, 0x80, 0x7F, 0x80, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0xFE, 0x00, 0xF7, 0x00, 0xE3, 0x80, 0xE3, 0x80, 0xE3, 0x80, 0xE3, 0x80, 0xE3, 0x80,
+    0xF7, 0x00, 0xFE, 0x00, 0x3F, 0x73, 0xF0, 0xE0, 0xE0, 0xE0, 0xF0, 0x73, 0x3F, 0x1D, 0xC0, 0x1D,
+    0x80, 0x3B, 0xFF, 0x3B, 0x07, 0x3F, 0x77, 0x7E, 0x76, 0xF8, 0x70, 0xFB, 0xFE, 0xFB, 0xFE, 0x3F,
+    0x77, 0x3F, 0x77, 0x3E, 0x73, 0x38, 0x70, 0x38, 0x70, 0x3B, 0xE0, 0x30, 0x00, 0x73, 0xFF, 0x70,
+    0x0F, 0xFE, 0x1E, 0x7E, 0x3C, 0x6E, 0x38, 0xEE, 0x30, 0xEF, 0xFF, 0xFC, 0x30, 0x7C, 0x30, 0x38,
+    0x30, 0x3E, 0x30, 0x7E, 0x30, 0xE0, 0x30, 0xC1, 0xF0, 0x30, 0x0E, 0x30, 0x0E, 0x3F, 0xEE, 0x30,
+    0xEE, 0xFC, 0xFF, 0x76, 0xCE, 0x77, 0xFE, 0x7B, 0xFE, 0xFF, 0xFE, 0xF3, 0xDE, 0xF3, 0xCE, 0x37,
+    0xEE, 0x3E, 0x6E, 0x3C, 0x0E, 0x30, 0x3E, 0xE0, 0x1F, 0xFF, 0xF0, 0x3E, 0x00, 0x0E, 0x1F, 0xCF,
+    0xFB, 0xFF, 0xF8, 0x3F, 0xFF, 0x0F, 0xFF, 0x7F, 0xD8, 0x7F, 0xDC, 0x6F, 0xCE, 0xED, 0xFF, 0xFD,
+    0xF7, 0xF9, 0xC0, 0x06, 0x70, 0xFF, 0xFF, 0x3E, 0x70, 0x38, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0xFF,
+    0xFC, 0x3B, 0x8C, 0x39, 0xCC, 0xFF, 0xFF, 0x73, 0x9C, 0x71, 0xDC, 0x7F, 0xFF, 0x00, 0x1C, 0x01,
+    0xF8,
+};
+
+#endif
@@ -0,0 +1,117 @@
+/* Generated by font_pack.py from font12.c, do not edit */
+#ifndef __FONT12_PACKED_H
+#define __FONT12_PACKED_H
+
+#include "fonts.h"
+
+/* 7 x 12, 1034 bytes instead of 1140 */
+static const uint8_t Font12_Packed[] = {
+    0x00, 0x00, 0x00, 0x00, // ' '
+    0x03, 0x01, 0x01, 0x08, 0xF9, // '!'
+    0x01, 0x01, 0x05, 0x03, 0xDC, 0xA4, // '"'
+    0x01, 0x01, 0x05, 0x09, 0x29, 0x55, 0xF5, 0x7D, 0x54, 0xA0, // '#'
+    0x01, 0x01, 0x04, 0x09, 0x27, 0x88, 0x79, 0xE2, 0x20, // '$'
+    0x01, 0x01, 0x05, 0x08, 0x45, 0x10, 0x3E, 0x08, 0xA2, // '%'
+    0x01, 0x03, 0x05, 0x06, 0x32, 0x11, 0x59, 0x34, // '&'
+    0x03, 0x01, 0x01, 0x04, 0xF0, // '''
+    0x03, 0x01, 0x02, 0x0A, 0x5A, 0xAA, 0x50, // '('
+    0x02, 0x01, 0x02, 0x0A, 0xA5, 0x55, 0xA0, // ')'
+    0x01, 0x01, 0x05, 0x05, 0x27, 0xC8, 0xA5, 0x00, // '*'
+    0x00, 0x02, 0x07, 0x07, 0x10, 0x20, 0x47, 0xF1, 0x02, 0x04, 0x00, // '+'
+    0x02, 0x07, 0x03, 0x04, 0x6B, 0x40, // ','
+    0x01, 0x05, 0x05, 0x01, 0xF8, // '-'
+    0x02, 0x07, 0x02, 0x02, 0xF0, // '.'
+    0x01, 0x01, 0x05, 0x09, 0x08, 0x44, 0x22, 0x11, 0x08, 0x80, // '/'
+    0x01, 0x01, 0x05, 0x08, 0x74, 0x63, 0x18, 0xC6, 0x2E, // '0'
+    0x01, 0x01, 0x05, 0x08, 0x61, 0x08, 0x42, 0x10, 0x9F, // '1'
+    0x01, 0x01, 0x05, 0x08, 0x74, 0x42, 0x22, 0x22, 0x3F, // '2'
+    0x01, 0x01, 0x05, 0x08, 0x74, 0x42, 0x60, 0x86, 0x2E, // '3'
+    0x01, 0x01, 0x06, 0x08, 0x18, 0xA2, 0x92, 0x8B, 0xF0, 0x87, // '4'
+    0x01, 0x01, 0x05, 0x08, 0x7A, 0x10, 0xE0, 0x86, 0x2E, // '5'
+    0x01, 0x01, 0x05, 0x08, 0x3A, 0x21, 0xE8, 0xC6, 0x2E, // '6'
+    0x01, 0x01, 0x05, 0x08, 0xFC, 0x42, 0x21, 0x08, 0x84, // '7'
+    0x01, 0x01, 0x05, 0x08, 0x74, 0x62, 0xE8, 0xC6, 0x2E, // '8'
+    0x01, 0x01, 0x05, 0x08, 0x74, 0x63, 0x17, 0x84, 0x5C, // '9'
+    0x02, 0x03, 0x02, 0x06, 0xF0, 0xF0, // ':'
+    0x02, 0x03, 0x03, 0x07, 0x6C, 0x07, 0xA0, // ';'
+    0x00, 0x02, 0x06, 0x07, 0x0C, 0x46, 0x20, 0x60, 0x40, 0xC0, // '<'
+    0x01, 0x04, 0x05, 0x03, 0xF8, 0x3E, // '='
+    0x00, 0x02, 0x06, 0x07, 0xC0, 0x81, 0x81, 0x18, 0x8C, 0x00, // '>'
+    0x02, 0x02, 0x04, 0x07, 0x69, 0x12, 0x40, 0xC0, // '?'
+    0x01, 0x00, 0x05, 0x0A, 0x74, 0x63, 0x3A, 0xD6, 0x70, 0x8B, 0x80, // '@'
+    0x00, 0x01, 0x07, 0x08, 0x30, 0x20, 0xA1, 0x42, 0x8F, 0x91, 0x77, // 'A'
+    0x00, 0x01, 0x06, 0x08, 0xF9, 0x14, 0x5E, 0x45, 0x14, 0x7E, // 'B'
+    0x01, 0x01, 0x05, 0x08, 0x7C, 0x61, 0x08, 0x42, 0x2E, // 'C'
+    0x00, 0x01, 0x06, 0x08, 0xF1, 0x24, 0x51, 0x45, 0x14, 0xBC, // 'D'
+    0x00, 0x01, 0x06, 0x08, 0xFD, 0x15, 0x1C, 0x51, 0x04, 0x7F, // 'E'
+    0x01, 0x01, 0x06, 0x08, 0xFD, 0x15, 0x1C, 0x51, 0x04, 0x38, // 'F'
+    0x01, 0x01, 0x06, 0x08, 0x7A, 0x28, 0x20, 0x9E, 0x28, 0x9C, // 'G'
+    0x00, 0x01, 0x07, 0x08, 0xEE, 0x89, 0x13, 0xE4, 0x48, 0x91, 0x77, // 'H'
+    0x01, 0x01, 0x05, 0x08, 0xF9, 0x08, 0x42, 0x10, 0x9F, // 'I'
+    0x01, 0x01, 0x05, 0x08, 0x78, 0x84, 0x29, 0x4A, 0x4C, // 'J'
+    0x00, 0x01, 0x07, 0x08, 0xEE, 0x89, 0x22, 0x87, 0x09, 0x11, 0x73, // 'K'
+    0x01, 0x01, 0x05, 0x08, 0xE2, 0x10, 0x84, 0x25, 0x3F, // 'L'
+    0x00, 0x01, 0x07, 0x08, 0xEE, 0xD9, 0xB2, 0xA5, 0x48, 0x91, 0x77, // 'M'
+    0x00, 0x01, 0x07, 0x08, 0xEE, 0xC9, 0x92, 0xA5, 0x4A, 0x93, 0x76, // 'N'
+    0x01, 0x01, 0x05, 0x08, 0x74, 0x63, 0x18, 0xC6, 0x2E, // 'O'
+    0x01, 0x01, 0x05, 0x08, 0xF2, 0x52, 0x97, 0x21, 0x1C, // 'P'
+    0x01, 0x01, 0x05, 0x09, 0x74, 0x63, 0x18, 0xC6, 0x2E, 0x38, // 'Q'
+    0x00, 0x01, 0x07, 0x08, 0xF8, 0x89, 0x12, 0x27, 0x89, 0x11, 0x71, // 'R'
+    0x01, 0x01, 0x05, 0x08, 0x6C, 0xE0, 0xE0, 0x87, 0x36, // 'S'
+    0x00, 0x01, 0x07, 0x08, 0xFF, 0x24, 0x40, 0x81, 0x02, 0x04, 0x1C, // 'T'
+    0x00, 0x01, 0x07, 0x08, 0xEE, 0x89, 0x12, 0x24, 0x48, 0x91, 0x1C, // 'U'
+    0x00, 0x01, 0x07, 0x08, 0xEE, 0x89, 0x11, 0x42, 0x85, 0x04, 0x08, // 'V'
+    0x00, 0x01, 0x07, 0x08, 0xEE, 0x89, 0x12, 0xA5, 0x4A, 0x95, 0x14, // 'W'
+    0x00, 0x01, 0x07, 0x08, 0xC6, 0x88, 0xA0, 0x81, 0x05, 0x11, 0x63, // 'X'
+    0x00, 0x01, 0x07, 0x08, 0xEE, 0x88, 0xA1, 0x41, 0x02, 0x04, 0x1C, // 'Y'
+    0x01, 0x01, 0x05, 0x08, 0xFC, 0x44, 0x42, 0x22, 0x3F, // 'Z'
+    0x02, 0x01, 0x03, 0x0A, 0xF2, 0x49, 0x24, 0x9C, // '['
+    0x01, 0x01, 0x04, 0x09, 0x84, 0x44, 0x22, 0x11, 0x10, // '\'
+    0x02, 0x01, 0x03, 0x0A, 0xE4, 0x92, 0x49, 0x3C, // ']'
+    0x01, 0x01, 0x05, 0x04, 0x21, 0x15, 0x10, // '^'
+    0x00, 0x0B, 0x07, 0x01, 0xFE, // '_'
+    0x03, 0x01, 0x02, 0x02, 0x90, // '`'
+    0x01, 0x03, 0x06, 0x06, 0x72, 0x27, 0xA2, 0x89, 0xF0, // 'a'
+    0x00, 0x01, 0x06, 0x08, 0xC1, 0x05, 0x99, 0x45, 0x14, 0x7E, // 'b'
+    0x01, 0x03, 0x05, 0x06, 0x7C, 0x61, 0x08, 0xB8, // 'c'
+    0x01, 0x01, 0x06, 0x08, 0x18, 0x26, 0xA6, 0x8A, 0x28, 0x9F, // 'd'
+    0x01, 0x03, 0x05, 0x06, 0x74, 0x7F, 0x08, 0x3C, // 'e'
+    0x01, 0x01, 0x05, 0x08, 0x3A, 0x3E, 0x84, 0x21, 0x1F, // 'f'
+    0x01, 0x03, 0x06, 0x08, 0x6E, 0x68, 0xA2, 0x89, 0xE0, 0x9C, // 'g'
+    0x00, 0x01, 0x07, 0x08, 0xC0, 0x81, 0x63, 0x24, 0x48, 0x91, 0x77, // 'h'
+    0x01, 0x01, 0x05, 0x08, 0x20, 0x38, 0x42, 0x10, 0x9F, // 'i'
+    0x01, 0x01, 0x04, 0x0A, 0x20, 0xF1, 0x11, 0x11, 0x1E, // 'j'
+    0x00, 0x01, 0x06, 0x08, 0xC1, 0x05, 0xD2, 0x71, 0x44, 0xB7, // 'k'
+    0x01, 0x01, 0x05, 0x08, 0x61, 0x08, 0x42, 0x10, 0x9F, // 'l'
+    0x00, 0x03, 0x07, 0x06, 0xE8, 0xA9, 0x52, 0xA5, 0x5F, 0xC0, // 'm'
+    0x00, 0x03, 0x07, 0x06, 0xD8, 0xC9, 0x12, 0x24, 0x5D, 0xC0, // 'n'
+    0x01, 0x03, 0x05, 0x06, 0x74, 0x63, 0x18, 0xB8, // 'o'
+    0x00, 0x03, 0x06, 0x08, 0xD9, 0x94, 0x51, 0x45, 0xE4, 0x38, // 'p'
+    0x01, 0x03, 0x06, 0x08, 0x6E, 0x68, 0xA2, 0x89, 0xE0, 0x87, // 'q'
+    0x01, 0x03, 0x05, 0x06, 0xDB, 0x10, 0x84, 0x7C, // 'r'
+    0x01, 0x03, 0x05, 0x06, 0x7C, 0x5C, 0x18, 0xF8, // 's'
+    0x01, 0x02, 0x06, 0x07, 0x43, 0xE4, 0x10, 0x41, 0x13, 0x80, // 't'
+    0x00, 0x03, 0x07, 0x06, 0xCC, 0x89, 0x12, 0x24, 0xC6, 0xC0, // 'u'
+    0x00, 0x03, 0x07, 0x06, 0xEE, 0x89, 0x11, 0x42, 0x82, 0x00, // 'v'
+    0x00, 0x03, 0x07, 0x06, 0xEE, 0x89, 0x52, 0xA5, 0x45, 0x00, // 'w'
+    0x00, 0x03, 0x06, 0x06, 0xCD, 0x23, 0x0C, 0x4B, 0x30, // 'x'
+    0x00, 0x03, 0x07, 0x08, 0xEE, 0x88, 0x91, 0x41, 0x82, 0x04, 0x3C, // 'y'
+    0x01, 0x03, 0x05, 0x06, 0xFC, 0x88, 0x88, 0xFC, // 'z'
+    0x02, 0x01, 0x03, 0x0A, 0x29, 0x25, 0x12, 0x44, // '{'
+    0x03, 0x01, 0x01, 0x09, 0xFF, 0x80, // '|'
+    0x02, 0x01, 0x03, 0x0A, 0x89, 0x24, 0x52, 0x50, // '}'
+    0x01, 0x05, 0x05, 0x02, 0x4D, 0x80, // '~'
+};
+
+static const uint16_t Font12_Offsets[96] = {
+        0,     4,     9,    15,    25,    34,    43,    51,    56,    63,    70,    78,
+       89,    95,   100,   105,   115,   124,   133,   142,   151,   161,   170,   179,
+      188,   197,   206,   212,   219,   229,   235,   245,   253,   264,   275,   285,
+      294,   304,   314,   324,   334,   345,   354,   363,   374,   383,   394,   405,
+      414,   423,   433,   444,   453,   464,   475,   486,   497,   508,   519,   528,
+      536,   545,   553,   560,   565,   570,   579,   589,   597,   607,   615,   624,
+      634,   645,   654,   663,   673,   682,   692,   702,   710,   720,   730,   738,
+      746,   756,   766,   776,   786,   795,   806,   814,   822,   828,   836,   842,
+};
+
+#endif
@@ -37,11 +37,13 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
+#include "font16_packed.h"
 
 //
 //  Font data for Courier New 12pt
 //
 
+#if FONT_BUILTIN && !FONT_ASCII_PACKED // Source of the packed glyphs, see font_pack.py
 const uint8_t Font16_Table[] = {
     // @0 ' ' (11 pixels wide)
     0x00,
@@ -3273,11 +3275,20 @@ const uint8_t Font16_Table[] = {
     0x00,
     0x00, //
 };
+#endif
 
 sFONT Font16 = {
+#if FONT_BUILTIN && !FONT_ASCII_PACKED
     Font16_Table,
+#else
+    NULL,
+#endif
     11, /* Width */
     16, /* Height */
+#if FONT_BUILTIN && FONT_ASCII_PACKED
+    Font16_Packed,
+    Font16_Offsets,
+#endif
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
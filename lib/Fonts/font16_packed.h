@@ -0,0 +1,117 @@
+/* Generated by font_pack.py from font16.c, do not edit */
+#ifndef __FONT16_PACKED_H
+#define __FONT16_PACKED_H
+
+#include "fonts.h"
+
+/* 11 x 16, 1392 bytes instead of 3040 */
+static const uint8_t Font16_Packed[] = {
+    0x00, 0x00, 0x00, 0x00, // ' '
+    0x04, 0x01, 0x02, 0x0A, 0xFF, 0xFF, 0x30, // '!'
+    0x03, 0x02, 0x07, 0x05, 0xEF, 0xDD, 0x12, 0x24, 0x40, // '"'
+    0x02, 0x01, 0x08, 0x0B, 0x36, 0x36, 0x36, 0x36, 0xFF, 0x6C, 0xFF, 0x6C, 0x6C, 0x6C, 0x6C, // '#'
+    0x02, 0x00, 0x07, 0x0D, 0x10, 0xFF, 0x1E, 0x3E, 0x0F, 0x0F, 0x07, 0xC7, 0x8F, 0xF0, 0x81, 0x00, // '$'
+    0x02, 0x01, 0x08, 0x0A, 0x60, 0x90, 0x90, 0x63, 0x1E, 0x78, 0xC6, 0x09, 0x09, 0x06, // '%'
+    0x02, 0x02, 0x07, 0x09, 0x3C, 0xC1, 0x83, 0x03, 0x0E, 0xF7, 0x66, 0x76, // '&'
+    0x05, 0x02, 0x03, 0x05, 0xFD, 0x24, // '''
+    0x04, 0x01, 0x04, 0x0C, 0x33, 0x6E, 0xCC, 0xCC, 0xE6, 0x33, // '('
+    0x03, 0x01, 0x04, 0x0C, 0xCC, 0x63, 0x33, 0x33, 0x36, 0xEC, // ')'
+    0x02, 0x01, 0x08, 0x07, 0x18, 0x18, 0xFF, 0xFF, 0x3C, 0x7E, 0x66, // '*'
+    0x02, 0x03, 0x07, 0x07, 0x10, 0x20, 0x47, 0xF1, 0x02, 0x04, 0x00, // '+'
+    0x04, 0x09, 0x03, 0x05, 0x6B, 0x48, // ','
+    0x02, 0x06, 0x07, 0x01, 0xFE, // '-'
+    0x04, 0x09, 0x02, 0x02, 0xF0, // '.'
+    0x02, 0x00, 0x08, 0x0D, 0x03, 0x03, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x30, 0x30, 0x60, 0x60, 0xC0, 0xC0, // '/'
+    0x02, 0x01, 0x07, 0x0A, 0x38, 0xDB, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0x6C, 0x70, // '0'
+    0x02, 0x01, 0x08, 0x0A, 0x18, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, // '1'
+    0x02, 0x01, 0x07, 0x0A, 0x3C, 0xCF, 0x1E, 0x30, 0xC3, 0x0C, 0x30, 0xC1, 0xFC, // '2'
+    0x01, 0x01, 0x08, 0x0A, 0x7E, 0xC3, 0x03, 0x06, 0x3E, 0x07, 0x03, 0x03, 0xC3, 0x7E, // '3'
+    0x02, 0x01, 0x07, 0x0A, 0x1C, 0x38, 0xF1, 0x66, 0xC9, 0xB3, 0x7F, 0x0C, 0x7C, // '4'
+    0x02, 0x01, 0x07, 0x0A, 0x7E, 0xC1, 0x83, 0x07, 0xC8, 0xC1, 0x83, 0x86, 0xF8, // '5'
+    0x02, 0x01, 0x07, 0x0A, 0x1E, 0xE1, 0x86, 0x0D, 0xDC, 0xF1, 0xE3, 0x66, 0x78, // '6'
+    0x01, 0x01, 0x07, 0x0A, 0xFF, 0x0C, 0x18, 0x60, 0xC1, 0x83, 0x0C, 0x18, 0x30, // '7'
+    0x02, 0x01, 0x07, 0x0A, 0x7D, 0x8F, 0x1E, 0x37, 0xD8, 0xF1, 0xE3, 0xC6, 0xF8, // '8'
+    0x02, 0x01, 0x07, 0x0A, 0x79, 0x9B, 0x1E, 0x3C, 0xEE, 0xC1, 0x86, 0x1D, 0xE0, // '9'
+    0x04, 0x04, 0x02, 0x07, 0xF0, 0x3C, // ':'
+    0x04, 0x04, 0x04, 0x09, 0x33, 0x00, 0x06, 0x48, 0x80, // ';'
+    0x01, 0x02, 0x09, 0x09, 0x01, 0x83, 0x02, 0x06, 0x0C, 0x01, 0x80, 0x20, 0x0C, 0x01, 0x80, // '<'
+    0x01, 0x05, 0x09, 0x03, 0xFF, 0x80, 0x3F, 0xE0, // '='
+    0x01, 0x02, 0x09, 0x09, 0xC0, 0x18, 0x02, 0x00, 0xC0, 0x18, 0x30, 0x20, 0x60, 0xC0, 0x00, // '>'
+    0x02, 0x02, 0x07, 0x09, 0x7D, 0x8F, 0x18, 0x31, 0xC6, 0x0C, 0x00, 0x30, // '?'
+    0x02, 0x01, 0x06, 0x0B, 0x39, 0x18, 0x61, 0x9E, 0x9A, 0x67, 0x81, 0x13, 0x80, // '@'
+    0x01, 0x02, 0x0A, 0x09, 0x7E, 0x07, 0x81, 0x20, 0xCC, 0x33, 0x0F, 0xC6, 0x19, 0x86, 0xF3, 0xC0, // 'A'
+    0x01, 0x02, 0x08, 0x09, 0xFE, 0x63, 0x63, 0x63, 0x7E, 0x63, 0x63, 0x63, 0xFE, // 'B'
+    0x01, 0x02, 0x09, 0x09, 0x3E, 0xB0, 0xF0, 0x38, 0x0C, 0x06, 0x03, 0x02, 0xC2, 0x3E, 0x00, // 'C'
+    0x01, 0x02, 0x09, 0x09, 0xFE, 0x31, 0x98, 0x6C, 0x36, 0x1B, 0x0D, 0x86, 0xC6, 0xFE, 0x00, // 'D'
+    0x01, 0x02, 0x08, 0x09, 0xFF, 0x61, 0x61, 0x64, 0x7C, 0x64, 0x61, 0x61, 0xFF, // 'E'
+    0x01, 0x02, 0x09, 0x09, 0xFF, 0xB0, 0x58, 0x2C, 0x87, 0xC3, 0x21, 0x80, 0xC0, 0xF8, 0x00, // 'F'
+    0x01, 0x02, 0x09, 0x09, 0x3D, 0x31, 0xB0, 0x58, 0x0C, 0x06, 0x7F, 0x0C, 0xC6, 0x3E, 0x00, // 'G'
+    0x01, 0x02, 0x09, 0x09, 0xF7, 0xB1, 0x98, 0xCC, 0x67, 0xF3, 0x19, 0x8C, 0xC6, 0xF7, 0x80, // 'H'
+    0x02, 0x02, 0x08, 0x09, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, // 'I'
+    0x01, 0x02, 0x09, 0x09, 0x3F, 0x83, 0x01, 0x80, 0xC0, 0x66, 0x33, 0x19, 0x8C, 0x7C, 0x00, // 'J'
+    0x01, 0x02, 0x09, 0x09, 0xF7, 0xB1, 0x99, 0x8D, 0x87, 0x83, 0xE1, 0x98, 0xC6, 0xF3, 0x80, // 'K'
+    0x01, 0x02, 0x09, 0x09, 0xFC, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x84, 0xC2, 0x61, 0xFF, 0x80, // 'L'
+    0x00, 0x02, 0x0B, 0x09, 0xE0, 0xEC, 0x19, 0xC7, 0x3D, 0xE6, 0xAC, 0xDD, 0x99, 0x33, 0x06, 0xFB, 0xE0, // 'M'
+    0x01, 0x02, 0x09, 0x09, 0xE7, 0xB1, 0x9C, 0xCF, 0x66, 0xB3, 0x79, 0x9C, 0xC6, 0xF3, 0x00, // 'N'
+    0x01, 0x02, 0x09, 0x09, 0x3E, 0x31, 0xB0, 0x78, 0x3C, 0x1E, 0x0F, 0x06, 0xC6, 0x3E, 0x00, // 'O'
+    0x01, 0x02, 0x08, 0x09, 0xFE, 0x63, 0x63, 0x63, 0x63, 0x7E, 0x60, 0x60, 0xFC, // 'P'
+    0x01, 0x02, 0x09, 0x0B, 0x3E, 0x31, 0xB0, 0x78, 0x3C, 0x1E, 0x0F, 0x06, 0xC6, 0x3E, 0x0C, 0xCF, 0xC0, // 'Q'
+    0x01, 0x02, 0x0A, 0x09, 0xFE, 0x18, 0xC6, 0x31, 0x8C, 0x7C, 0x19, 0x86, 0x31, 0x8C, 0xF9, 0xC0, // 'R'
+    0x02, 0x02, 0x07, 0x09, 0x7F, 0x8F, 0x1F, 0x07, 0xC1, 0xF1, 0xE3, 0xFC, // 'S'
+    0x01, 0x02, 0x08, 0x09, 0xFF, 0x99, 0x99, 0x99, 0x18, 0x18, 0x18, 0x18, 0x7E, // 'T'
+    0x01, 0x02, 0x09, 0x09, 0xF7, 0xB1, 0x98, 0xCC, 0x66, 0x33, 0x19, 0x8C, 0xC6, 0x3E, 0x00, // 'U'
+    0x01, 0x02, 0x09, 0x09, 0xF7, 0xB1, 0x98, 0xC6, 0xC3, 0x61, 0xB0, 0x50, 0x38, 0x1C, 0x00, // 'V'
+    0x00, 0x02, 0x0B, 0x09, 0xFB, 0xEC, 0x19, 0x93, 0x37, 0x66, 0xEC, 0x55, 0x0E, 0xE1, 0xDC, 0x31, 0x80, // 'W'
+    0x01, 0x02, 0x09, 0x09, 0xF7, 0xB1, 0x8D, 0x83, 0x81, 0xC0, 0xE0, 0xD8, 0xC6, 0xF7, 0x80, // 'X'
+    0x01, 0x02, 0x0A, 0x09, 0xF3, 0xD8, 0x63, 0x30, 0x78, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x3F, 0x00, // 'Y'
+    0x02, 0x02, 0x07, 0x09, 0xFF, 0x0E, 0x30, 0xC1, 0x06, 0x18, 0xE1, 0xFE, // 'Z'
+    0x05, 0x01, 0x04, 0x0C, 0xFC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCF, // '['
+    0x02, 0x00, 0x08, 0x0D, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03, // '\'
+    0x03, 0x01, 0x04, 0x0C, 0xF3, 0x33, 0x33, 0x33, 0x33, 0x3F, // ']'
+    0x02, 0x00, 0x07, 0x06, 0x10, 0x50, 0xA2, 0x28, 0x30, 0x40, // '^'
+    0x00, 0x0F, 0x0B, 0x01, 0xFF, 0xE0, // '_'
+    0x04, 0x00, 0x03, 0x03, 0x88, 0x80, // '`'
+    0x02, 0x04, 0x08, 0x07, 0x7C, 0x06, 0x06, 0x7E, 0xC6, 0xCE, 0x77, // 'a'
+    0x01, 0x01, 0x09, 0x0A, 0xE0, 0x30, 0x18, 0x0D, 0xC7, 0x33, 0x0D, 0x86, 0xC3, 0x73, 0x77, 0x00, // 'b'
+    0x01, 0x04, 0x08, 0x07, 0x3D, 0x63, 0xC1, 0xC0, 0xC1, 0x63, 0x3E, // 'c'
+    0x01, 0x01, 0x09, 0x0A, 0x07, 0x01, 0x80, 0xC7, 0x66, 0x76, 0x1B, 0x0D, 0x86, 0x67, 0x1D, 0xC0, // 'd'
+    0x01, 0x04, 0x09, 0x07, 0x3E, 0x31, 0xB0, 0x7F, 0xFC, 0x03, 0x0C, 0xFC, // 'e'
+    0x02, 0x01, 0x09, 0x0A, 0x1F, 0x98, 0x0C, 0x1F, 0xC3, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x7F, 0x00, // 'f'
+    0x01, 0x04, 0x09, 0x0A, 0x3B, 0xB3, 0xB0, 0xD8, 0x6C, 0x33, 0x38, 0xEC, 0x06, 0x03, 0x1F, 0x00, // 'g'
+    0x01, 0x01, 0x09, 0x0A, 0xE0, 0x30, 0x18, 0x0D, 0xC7, 0x33, 0x19, 0x8C, 0xC6, 0x63, 0x7B, 0xC0, // 'h'
+    0x02, 0x01, 0x08, 0x0A, 0x18, 0x18, 0x00, 0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, // 'i'
+    0x02, 0x01, 0x06, 0x0D, 0x18, 0x60, 0x3F, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0xF8, // 'j'
+    0x01, 0x01, 0x09, 0x0A, 0xE0, 0x30, 0x18, 0x0D, 0xE6, 0xC3, 0xC1, 0xE0, 0xD8, 0x66, 0x77, 0xC0, // 'k'
+    0x02, 0x01, 0x08, 0x0A, 0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, // 'l'
+    0x01, 0x04, 0x0A, 0x07, 0xFF, 0x1B, 0x66, 0xD9, 0xB6, 0x6D, 0x9B, 0x6E, 0xDC, // 'm'
+    0x01, 0x04, 0x09, 0x07, 0xEE, 0x39, 0x98, 0xCC, 0x66, 0x33, 0x1B, 0xDE, // 'n'
+    0x01, 0x04, 0x09, 0x07, 0x3E, 0x31, 0xB0, 0x78, 0x3C, 0x1B, 0x18, 0xF8, // 'o'
+    0x01, 0x04, 0x09, 0x0A, 0xEE, 0x39, 0x98, 0x6C, 0x36, 0x1B, 0x99, 0xB8, 0xC0, 0x60, 0x7C, 0x00, // 'p'
+    0x01, 0x04, 0x09, 0x0A, 0x3B, 0xB3, 0xB0, 0xD8, 0x6C, 0x33, 0x38, 0xEC, 0x06, 0x03, 0x07, 0xC0, // 'q'
+    0x01, 0x04, 0x09, 0x07, 0xF7, 0x1C, 0xCC, 0x06, 0x03, 0x01, 0x83, 0xF8, // 'r'
+    0x02, 0x04, 0x07, 0x07, 0x7F, 0x8F, 0xC3, 0xE0, 0xF8, 0xFF, 0x00, // 's'
+    0x01, 0x01, 0x08, 0x0A, 0x30, 0x30, 0x30, 0xFE, 0x30, 0x30, 0x30, 0x30, 0x31, 0x1E, // 't'
+    0x01, 0x04, 0x09, 0x07, 0xE7, 0x31, 0x98, 0xCC, 0x66, 0x33, 0x38, 0xEE, // 'u'
+    0x01, 0x04, 0x09, 0x07, 0xF7, 0xB1, 0x98, 0xC6, 0xC3, 0x60, 0xE0, 0x70, // 'v'
+    0x00, 0x04, 0x0B, 0x07, 0xF1, 0xEC, 0x19, 0x93, 0x37, 0x63, 0xB8, 0x77, 0x0C, 0x60, // 'w'
+    0x01, 0x04, 0x09, 0x07, 0xF7, 0x9B, 0x07, 0x03, 0x81, 0xC1, 0xB3, 0xDE, // 'x'
+    0x01, 0x04, 0x0A, 0x0A, 0xF3, 0xD8, 0x63, 0x30, 0xCC, 0x16, 0x07, 0x80, 0xC0, 0x30, 0x18, 0x1F, 0x00, // 'y'
+    0x02, 0x04, 0x07, 0x07, 0xFF, 0x0C, 0x31, 0xC6, 0x18, 0x7F, 0x80, // 'z'
+    0x03, 0x01, 0x04, 0x0C, 0x36, 0x66, 0x66, 0xC6, 0x66, 0x63, // '{'
+    0x05, 0x01, 0x02, 0x0C, 0xFF, 0xFF, 0xFF, // '|'
+    0x04, 0x01, 0x04, 0x0C, 0xC6, 0x66, 0x66, 0x36, 0x66, 0x6C, // '}'
+    0x02, 0x05, 0x07, 0x03, 0x61, 0x24, 0x30, // '~'
+};
+
+static const uint16_t Font16_Offsets[96] = {
+        0,     4,    11,    20,    35,    51,    65,    77,    83,    93,   103,   114,
+      125,   131,   136,   141,   158,   171,   185,   198,   212,   225,   238,   251,
+      264,   277,   290,   296,   305,   320,   328,   343,   355,   368,   384,   397,
+      412,   427,   440,   455,   470,   485,   498,   513,   528,   543,   560,   575,
+      590,   603,   620,   636,   648,   661,   676,   691,   708,   723,   739,   751,
+      761,   778,   788,   798,   804,   810,   821,   837,   848,   864,   876,   892,
+      908,   924,   938,   952,   968,   982,   995,  1007,  1019,  1035,  1051,  1063,
+     1074,  1088,  1100,  1112,  1126,  1138,  1155,  1166,  1176,  1183,  1193,  1200,
+};
+
+#endif
@@ -37,8 +37,10 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
+#include "font20_packed.h"
 
 // Character bitmaps for Courier New 15pt
+#if FONT_BUILTIN && !FONT_ASCII_PACKED // Source of the packed glyphs, see font_pack.py
 const uint8_t Font20_Table[] = {
     // @0 ' ' (14 pixels wide)
     0x00,
@@ -4030,11 +4032,20 @@ const uint8_t Font20_Table[] = {
     0x00,
     0x00, //
 };
+#endif
 
 sFONT Font20 = {
+#if FONT_BUILTIN && !FONT_ASCII_PACKED
     Font20_Table,
+#else
+    NULL,
+#endif
     14, /* Width */
     20, /* Height */
+#if FONT_BUILTIN && FONT_ASCII_PACKED
+    Font20_Packed,
+    Font20_Offsets,
+#endif
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
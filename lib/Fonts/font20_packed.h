@@ -0,0 +1,117 @@
+/* Generated by font_pack.py from font20.c, do not edit */
+#ifndef __FONT20_PACKED_H
+#define __FONT20_PACKED_H
+
+#include "fonts.h"
+
+/* 14 x 20, 1799 bytes instead of 3800 */
+static const uint8_t Font20_Packed[] = {
+    0x00, 0x00, 0x00, 0x00, // ' '
+    0x05, 0x01, 0x03, 0x0D, 0xFF, 0xFF, 0xFA, 0x40, 0x7E, // '!'
+    0x03, 0x02, 0x08, 0x06, 0xE7, 0xE7, 0xE7, 0x42, 0x42, 0x42, // '"'
+    0x02, 0x00, 0x0A, 0x10, 0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x3F, 0xFF, 0xFC, 0xCC, 0x33, 0x3F, 0xFF, 0xFC, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC, // '#'
+    0x03, 0x00, 0x08, 0x10, 0x18, 0x18, 0x3F, 0x7F, 0xC3, 0xC0, 0xF8, 0x7E, 0x07, 0xC3, 0xC3, 0xFE, 0xFC, 0x18, 0x18, 0x18, // '$'
+    0x02, 0x01, 0x09, 0x0D, 0x70, 0x44, 0x22, 0x11, 0x07, 0x18, 0x3C, 0xF9, 0xE0, 0xC7, 0x04, 0x42, 0x21, 0x10, 0x70, // '%'
+    0x03, 0x03, 0x09, 0x0B, 0x1F, 0x3F, 0x98, 0x0C, 0x03, 0x03, 0xCF, 0xFF, 0x9E, 0xC6, 0x7F, 0xCF, 0x60, // '&'
+    0x06, 0x02, 0x03, 0x06, 0xFF, 0xA4, 0x80, // '''
+    0x06, 0x01, 0x04, 0x10, 0x33, 0x66, 0x6C, 0xCC, 0xCC, 0xC6, 0x66, 0x33, // '('
+    0x04, 0x01, 0x04, 0x10, 0xCC, 0x66, 0x63, 0x33, 0x33, 0x36, 0x66, 0xCC, // ')'
+    0x03, 0x01, 0x08, 0x09, 0x18, 0x18, 0x18, 0xDB, 0xFF, 0x3C, 0x3C, 0x7E, 0x66, // '*'
+    0x02, 0x03, 0x0A, 0x0A, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0xFF, 0xFF, 0xF0, 0xC0, 0x30, 0x0C, 0x03, 0x00, // '+'
+    0x05, 0x0B, 0x04, 0x06, 0x76, 0x6C, 0xC8, // ','
+    0x02, 0x07, 0x09, 0x02, 0xFF, 0xFF, 0xC0, // '-'
+    0x06, 0x0B, 0x03, 0x03, 0xFF, 0x80, // '.'
+    0x03, 0x00, 0x08, 0x10, 0x03, 0x03, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x30, 0x60, 0x60, 0x60, 0xC0, 0xC0, // '/'
+    0x02, 0x01, 0x09, 0x0D, 0x3E, 0x3F, 0x98, 0xD8, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xD8, 0xCF, 0xE3, 0xE0, // '0'
+    0x03, 0x01, 0x08, 0x0D, 0x18, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, // '1'
+    0x02, 0x01, 0x09, 0x0D, 0x3E, 0x3F, 0xB8, 0xF8, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1F, 0xFF, 0xF8, // '2'
+    0x01, 0x01, 0x0A, 0x0D, 0x1F, 0x1F, 0xE6, 0x1C, 0x03, 0x01, 0xC3, 0xE0, 0xF8, 0x07, 0x00, 0xC0, 0x3C, 0x1F, 0xFE, 0x7F, 0x00, // '3'
+    0x02, 0x01, 0x09, 0x0D, 0x07, 0x07, 0x83, 0xC3, 0x63, 0x31, 0x99, 0x8D, 0x86, 0xFF, 0xFF, 0xC0, 0xC1, 0xF0, 0xF8, // '4'
+    0x02, 0x01, 0x09, 0x0D, 0x7F, 0x3F, 0x98, 0x0C, 0x07, 0xE3, 0xF9, 0x8E, 0x03, 0x01, 0x80, 0xF0, 0xFF, 0xE7, 0xE0, // '5'
+    0x02, 0x01, 0x09, 0x0D, 0x0F, 0x9F, 0xDE, 0x0C, 0x0E, 0x06, 0xF3, 0xFD, 0xC7, 0xC1, 0xE0, 0xD8, 0xEF, 0xE1, 0xE0, // '6'
+    0x02, 0x01, 0x09, 0x0D, 0xFF, 0xFF, 0xF0, 0x60, 0x30, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x03, 0x03, 0x01, 0x80, 0xC0, // '7'
+    0x02, 0x01, 0x09, 0x0D, 0x3E, 0x3F, 0xB8, 0xF8, 0x3E, 0x3B, 0xF9, 0xFD, 0xC7, 0xC1, 0xE0, 0xF8, 0xEF, 0xE3, 0xE0, // '8'
+    0x02, 0x01, 0x09, 0x0D, 0x3C, 0x3F, 0xB8, 0xD8, 0x3C, 0x1F, 0x1D, 0xFE, 0x7B, 0x03, 0x81, 0x83, 0xDF, 0xCF, 0x80, // '9'
+    0x06, 0x05, 0x03, 0x09, 0xFF, 0x80, 0x3F, 0xE0, // ':'
+    0x05, 0x05, 0x05, 0x0B, 0x39, 0xCE, 0x00, 0x01, 0xCC, 0xC6, 0x20, // ';'
+    0x01, 0x03, 0x0B, 0x0B, 0x00, 0x60, 0x3C, 0x1E, 0x07, 0x03, 0x81, 0xE0, 0x0E, 0x00, 0x70, 0x07, 0x80, 0x3C, 0x01, 0x80, // '<'
+    0x01, 0x05, 0x0B, 0x06, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, // '='
+    0x02, 0x03, 0x0B, 0x0B, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x00, 0x38, 0x03, 0xC0, 0xE0, 0x70, 0x3C, 0x1E, 0x03, 0x00, 0x00, // '>'
+    0x03, 0x02, 0x08, 0x0C, 0x7C, 0xFE, 0xC3, 0xC3, 0x03, 0x0E, 0x1C, 0x18, 0x00, 0x00, 0x38, 0x38, // '?'
+    0x03, 0x01, 0x07, 0x0E, 0x1C, 0xC9, 0x0C, 0x18, 0x31, 0xE4, 0xC9, 0x93, 0x1E, 0x02, 0x04, 0x27, 0x80, // '@'
+    0x01, 0x02, 0x0C, 0x0C, 0x3F, 0x03, 0xF0, 0x07, 0x00, 0xD8, 0x0D, 0x81, 0x98, 0x18, 0xC3, 0xFC, 0x3F, 0xC6, 0x06, 0xF0, 0xFF, 0x0F, // 'A'
+    0x02, 0x02, 0x0A, 0x0C, 0xFE, 0x3F, 0xC6, 0x19, 0x86, 0x63, 0x9F, 0xC7, 0xF9, 0x87, 0x60, 0xD8, 0x3F, 0xFF, 0xFE, // 'B'
+    0x02, 0x02, 0x0A, 0x0C, 0x1E, 0xCF, 0xF7, 0x1F, 0x83, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xE0, 0xDC, 0x73, 0xF8, 0x7C, // 'C'
+    0x01, 0x02, 0x0B, 0x0C, 0xFF, 0x1F, 0xF1, 0x87, 0x30, 0x76, 0x06, 0xC0, 0xD8, 0x1B, 0x03, 0x60, 0xEC, 0x3B, 0xFE, 0x7F, 0x80, // 'D'
+    0x02, 0x02, 0x0A, 0x0C, 0xFF, 0xFF, 0xF6, 0x0D, 0x83, 0x66, 0x1F, 0x87, 0xE1, 0x98, 0x60, 0xD8, 0x3F, 0xFF, 0xFF, // 'E'
+    0x02, 0x02, 0x0A, 0x0C, 0xFF, 0xFF, 0xF6, 0x0D, 0x83, 0x66, 0x1F, 0x87, 0xE1, 0x98, 0x60, 0x18, 0x0F, 0xC3, 0xF0, // 'F'
+    0x02, 0x02, 0x0B, 0x0C, 0x1E, 0xCF, 0xF9, 0x87, 0x60, 0x6C, 0x01, 0x80, 0x31, 0xFE, 0x3F, 0xC0, 0xCC, 0x19, 0xFF, 0x0F, 0x80, // 'G'
+    0x02, 0x02, 0x0A, 0x0C, 0xF3, 0xFC, 0xF6, 0x19, 0x86, 0x61, 0x9F, 0xE7, 0xF9, 0x86, 0x61, 0x98, 0x6F, 0x3F, 0xCF, // 'H'
+    0x03, 0x02, 0x08, 0x0C, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, // 'I'
+    0x02, 0x02, 0x0B, 0x0C, 0x0F, 0xE1, 0xFC, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x30, 0x66, 0x0C, 0xC1, 0x98, 0x73, 0xFC, 0x1F, 0x00, // 'J'
+    0x02, 0x02, 0x0B, 0x0C, 0xFB, 0xFF, 0x7D, 0x8E, 0x33, 0x06, 0xC0, 0xF8, 0x1D, 0x83, 0x18, 0x63, 0x0C, 0x33, 0xE7, 0xFC, 0x70, // 'K'
+    0x02, 0x02, 0x0A, 0x0C, 0xFC, 0x3F, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC3, 0x30, 0xCC, 0x3F, 0xFF, 0xFF, // 'L'
+    0x01, 0x02, 0x0C, 0x0C, 0xF0, 0xFF, 0x0F, 0x70, 0xE7, 0x9E, 0x69, 0x66, 0xF6, 0x6F, 0x66, 0x66, 0x66, 0x66, 0x06, 0xF9, 0xFF, 0x9F, // 'M'
+    0x02, 0x02, 0x0A, 0x0C, 0xE7, 0xFD, 0xF7, 0x19, 0xE6, 0x79, 0x9B, 0x66, 0xD9, 0x9E, 0x67, 0x98, 0xEF, 0xBB, 0xE6, // 'N'
+    0x02, 0x02, 0x0A, 0x0C, 0x1E, 0x0F, 0xC7, 0x3B, 0x87, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xE1, 0xDC, 0xE3, 0xF0, 0x78, // 'O'
+    0x02, 0x02, 0x0A, 0x0C, 0xFF, 0x3F, 0xE6, 0x1D, 0x83, 0x60, 0xD8, 0x77, 0xF9, 0xFC, 0x60, 0x18, 0x0F, 0xC3, 0xF0, // 'P'
+    0x02, 0x02, 0x0A, 0x0F, 0x1E, 0x0F, 0xC7, 0x3B, 0x87, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xE1, 0xDC, 0xE3, 0xF0, 0x78, 0x1E, 0xCF, 0xF3, 0x38, // 'Q'
+    0x02, 0x02, 0x0B, 0x0C, 0xFF, 0x1F, 0xF1, 0x87, 0x30, 0x66, 0x1C, 0xFF, 0x1F, 0xC3, 0x1C, 0x61, 0x8C, 0x3B, 0xE3, 0xFC, 0x30, // 'R'
+    0x02, 0x02, 0x0A, 0x0C, 0x3E, 0xDF, 0xFE, 0x1F, 0x03, 0xE0, 0x1F, 0x81, 0xF8, 0x07, 0xC0, 0xF8, 0x7F, 0xFB, 0x7C, // 'S'
+    0x02, 0x02, 0x0A, 0x0C, 0xFF, 0xFF, 0xFC, 0xCF, 0x33, 0xCC, 0xC3, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x03, 0xF0, 0xFC, // 'T'
+    0x02, 0x02, 0x0A, 0x0C, 0xF3, 0xFC, 0xF6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x9C, 0xE3, 0xF0, 0x78, // 'U'
+    0x01, 0x02, 0x0B, 0x0C, 0xF1, 0xFE, 0x3D, 0x83, 0x30, 0x63, 0x18, 0x63, 0x06, 0xC0, 0xD8, 0x1B, 0x01, 0xC0, 0x38, 0x07, 0x00, // 'V'
+    0x01, 0x02, 0x0D, 0x0C, 0xF8, 0xFF, 0xC7, 0xD8, 0x0C, 0xCE, 0x66, 0x73, 0x33, 0x99, 0xB6, 0xC5, 0xB4, 0x38, 0xE1, 0xC7, 0x0E, 0x38, 0x60, 0xC0, // 'W'
+    0x01, 0x02, 0x0B, 0x0C, 0xF1, 0xFE, 0x3D, 0x83, 0x18, 0xC1, 0xB0, 0x1C, 0x03, 0x80, 0xD8, 0x31, 0x8C, 0x1B, 0xC7, 0xF8, 0xF0, // 'X'
+    0x02, 0x02, 0x0A, 0x0C, 0xF3, 0xFC, 0xF6, 0x18, 0xCC, 0x1E, 0x07, 0x80, 0xC0, 0x30, 0x0C, 0x03, 0x03, 0xF0, 0xFC, // 'Y'
+    0x03, 0x02, 0x08, 0x0C, 0xFF, 0xFF, 0xC3, 0xC6, 0x0C, 0x18, 0x18, 0x30, 0x63, 0xC3, 0xFF, 0xFF, // 'Z'
+    0x06, 0x01, 0x04, 0x10, 0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFF, // '['
+    0x03, 0x00, 0x08, 0x10, 0xC0, 0xC0, 0x60, 0x60, 0x60, 0x30, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x06, 0x03, 0x03, // '\'
+    0x04, 0x01, 0x04, 0x10, 0xFF, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xFF, // ']'
+    0x02, 0x01, 0x09, 0x06, 0x08, 0x0E, 0x0D, 0x8C, 0x6C, 0x1C, 0x04, // '^'
+    0x00, 0x12, 0x0E, 0x02, 0xFF, 0xFF, 0xFF, 0xF0, // '_'
+    0x05, 0x01, 0x04, 0x03, 0x86, 0x10, // '`'
+    0x02, 0x05, 0x0A, 0x09, 0x3F, 0x1F, 0xE0, 0x18, 0xFE, 0x7F, 0xB8, 0x6C, 0x3B, 0xFF, 0x7D, 0xC0, // 'a'
+    0x01, 0x01, 0x0B, 0x0D, 0xE0, 0x1C, 0x01, 0x80, 0x30, 0x06, 0xF0, 0xFF, 0x9C, 0x33, 0x03, 0x60, 0x6C, 0x0D, 0xC3, 0x7F, 0xEE, 0xF0, // 'b'
+    0x02, 0x05, 0x0A, 0x09, 0x1E, 0xDF, 0xF6, 0x0F, 0x03, 0xC0, 0x30, 0x0E, 0x0D, 0xFF, 0x3F, 0x00, // 'c'
+    0x02, 0x01, 0x0B, 0x0D, 0x01, 0xC0, 0x38, 0x03, 0x00, 0x61, 0xEC, 0xFF, 0x98, 0x76, 0x06, 0xC0, 0xD8, 0x1B, 0x87, 0x3F, 0xF1, 0xEE, // 'd'
+    0x02, 0x05, 0x0A, 0x09, 0x1E, 0x1F, 0xE6, 0x1B, 0xFF, 0xFF, 0xF0, 0x06, 0x0D, 0xFF, 0x1F, 0x00, // 'e'
+    0x03, 0x01, 0x09, 0x0D, 0x1F, 0x9F, 0xCC, 0x06, 0x0F, 0xF7, 0xF8, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x1F, 0xEF, 0xF0, // 'f'
+    0x02, 0x05, 0x0B, 0x0D, 0x1E, 0xEF, 0xFD, 0x87, 0x60, 0x6C, 0x0D, 0x81, 0x98, 0x73, 0xFE, 0x1E, 0xC0, 0x18, 0x07, 0x1F, 0xC3, 0xF0, // 'g'
+    0x02, 0x01, 0x0A, 0x0D, 0xE0, 0x38, 0x06, 0x01, 0x80, 0x6F, 0x1F, 0xE7, 0x19, 0x86, 0x61, 0x98, 0x66, 0x1B, 0xCF, 0xF3, 0xC0, // 'h'
+    0x03, 0x01, 0x08, 0x0D, 0x18, 0x18, 0x00, 0x00, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, // 'i'
+    0x02, 0x01, 0x08, 0x11, 0x0C, 0x0C, 0x00, 0x00, 0x7F, 0x7F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0xFE, 0xFC, // 'j'
+    0x02, 0x01, 0x0A, 0x0D, 0xE0, 0x38, 0x06, 0x01, 0x80, 0x6F, 0x9B, 0xE6, 0xC1, 0xE0, 0x78, 0x1B, 0x06, 0x63, 0x9F, 0xE7, 0xC0, // 'k'
+    0x03, 0x01, 0x08, 0x0D, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, // 'l'
+    0x01, 0x05, 0x0C, 0x09, 0xFD, 0xCF, 0xFE, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6F, 0x77, 0xF7, 0x70, // 'm'
+    0x02, 0x05, 0x0A, 0x09, 0xEF, 0x3F, 0xE7, 0x19, 0x86, 0x61, 0x98, 0x66, 0x1B, 0xCF, 0xF3, 0xC0, // 'n'
+    0x02, 0x05, 0x0A, 0x09, 0x1E, 0x1F, 0xE6, 0x1B, 0x03, 0xC0, 0xF0, 0x36, 0x19, 0xFE, 0x1E, 0x00, // 'o'
+    0x01, 0x05, 0x0B, 0x0D, 0xEF, 0x1F, 0xF9, 0xC3, 0x30, 0x36, 0x06, 0xC0, 0xDC, 0x33, 0xFE, 0x6F, 0x0C, 0x01, 0x80, 0x7C, 0x0F, 0x80, // 'p'
+    0x02, 0x05, 0x0B, 0x0D, 0x1E, 0xEF, 0xFD, 0x87, 0x60, 0x6C, 0x0D, 0x81, 0x98, 0x73, 0xFE, 0x1E, 0xC0, 0x18, 0x03, 0x01, 0xF0, 0x3E, // 'q'
+    0x02, 0x05, 0x0A, 0x09, 0xF3, 0xBD, 0xF3, 0xCC, 0xE0, 0x30, 0x0C, 0x03, 0x03, 0xFC, 0xFF, 0x00, // 'r'
+    0x03, 0x05, 0x08, 0x09, 0x3F, 0xFF, 0xC3, 0xF0, 0x7E, 0x0F, 0xC3, 0xFF, 0xFC, // 's'
+    0x02, 0x02, 0x0A, 0x0C, 0x30, 0x0C, 0x03, 0x03, 0xFE, 0xFF, 0x8C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x33, 0xFC, 0x7C, // 't'
+    0x02, 0x05, 0x0A, 0x09, 0xE3, 0xB8, 0xE6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x39, 0xFF, 0x3D, 0xC0, // 'u'
+    0x01, 0x05, 0x0B, 0x09, 0xF1, 0xFE, 0x3D, 0x83, 0x18, 0xC3, 0x18, 0x36, 0x06, 0xC0, 0x70, 0x0E, 0x00, // 'v'
+    0x01, 0x05, 0x0B, 0x09, 0xF1, 0xFE, 0x3D, 0x93, 0x32, 0x66, 0xFC, 0x77, 0x0E, 0xE1, 0x8C, 0x31, 0x80, // 'w'
+    0x02, 0x05, 0x0A, 0x09, 0xF3, 0xFC, 0xF3, 0x30, 0x78, 0x0C, 0x07, 0x83, 0x33, 0xCF, 0xF3, 0xC0, // 'x'
+    0x01, 0x05, 0x0B, 0x0D, 0xF1, 0xFE, 0x3D, 0x83, 0x18, 0xC3, 0x18, 0x36, 0x07, 0xC0, 0x70, 0x0C, 0x01, 0x80, 0x60, 0x7F, 0x0F, 0xE0, // 'y'
+    0x03, 0x05, 0x08, 0x09, 0xFF, 0xFF, 0xC6, 0x0C, 0x18, 0x30, 0x63, 0xFF, 0xFF, // 'z'
+    0x04, 0x01, 0x06, 0x10, 0x1C, 0xF3, 0x0C, 0x30, 0xC3, 0x1C, 0xE1, 0xC3, 0x0C, 0x30, 0xC3, 0xC7, // '{'
+    0x06, 0x01, 0x02, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, // '|'
+    0x03, 0x01, 0x06, 0x10, 0xE3, 0xC3, 0x0C, 0x30, 0xC3, 0x0E, 0x1C, 0xE3, 0x0C, 0x30, 0xCF, 0x38, // '}'
+    0x02, 0x06, 0x0A, 0x04, 0x38, 0x3F, 0x3C, 0xFC, 0x1E, // '~'
+};
+
+static const uint16_t Font20_Offsets[96] = {
+        0,     4,    13,    23,    47,    67,    86,   103,   110,   122,   134,   147,
+      164,   171,   178,   184,   204,   223,   240,   259,   280,   299,   318,   337,
+      356,   375,   394,   402,   413,   433,   446,   466,   482,   499,   521,   540,
+      559,   580,   599,   618,   639,   658,   674,   695,   716,   735,   757,   776,
+      795,   814,   837,   858,   877,   896,   915,   936,   960,   981,  1000,  1016,
+     1028,  1048,  1060,  1071,  1079,  1085,  1101,  1123,  1139,  1161,  1177,  1196,
+     1218,  1239,  1256,  1277,  1298,  1315,  1333,  1349,  1365,  1387,  1409,  1425,
+     1438,  1457,  1473,  1490,  1507,  1523,  1545,  1558,  1574,  1582,  1598,  1607,
+};
+
+#endif
@@ -37,7 +37,9 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
+#include "font24_packed.h"
 
+#if FONT_BUILTIN && !FONT_ASCII_PACKED // Source of the packed glyphs, see font_pack.py
 const uint8_t Font24_Table[] = {
     // @0 ' ' (17 pixels wide)
     0x00,
@@ -7069,11 +7071,20 @@ const uint8_t Font24_Table[] = {
     0x00,
     0x00, //
 };
+#endif
 
 sFONT Font24 = {
+#if FONT_BUILTIN && !FONT_ASCII_PACKED
     Font24_Table,
+#else
+    NULL,
+#endif
     17, /* Width */
     24, /* Height */
+#if FONT_BUILTIN && FONT_ASCII_PACKED
+    Font24_Packed,
+    Font24_Offsets,
+#endif
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
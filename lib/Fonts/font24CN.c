@@ -37,7 +37,9 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
+#include "font24CN_index.h"
 
+#if FONT_BUILTIN && !FONT_CN_PACKED // Source of the packed glyphs, see cn_index.py
 const CH_CN Font24CN_Table[] = {
     /*--  文字:  你  --*/
     /*--  微软雅黑24;  此字体下对应的点阵为：宽x高=32x41   --*/
@@ -391,13 +393,33 @@ const CH_CN Font24CN_Table[] = {
       0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},
 
 };
+#endif
 
 cFONT Font24CN = {
+#if FONT_BUILTIN && !FONT_CN_PACKED
     Font24CN_Table,
-    sizeof(Font24CN_Table) / sizeof(CH_CN), /*size of table*/
-    24,                                     /* ASCII Width */
-    32,                                     /* Width */
-    41,                                     /* Height */
+    sizeof(Font24CN_Table) / sizeof(CH_CN),    /*size of table*/
+#else
+    NULL,
+    0,
+#endif
+    24,                                        /* ASCII Width */
+    32,                                        /* Width */
+    41,                                        /* Height */
+#if FONT_BUILTIN
+    Font24CN_Index,
+    sizeof(Font24CN_Index) / sizeof(CN_INDEX), /*size of index*/
+#else
+    NULL,
+    0,
+#endif
+#if FONT_BUILTIN && FONT_CN_PACKED
+    Font24CN_Glyphs,
+    Font24CN_Bitmap,
+#else
+    NULL,
+    NULL,
+#endif
 };
 
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
@@ -0,0 +1,249 @@
+/* Generated by cn_index.py from font24CN.c, do not edit */
+#ifndef __FONT24CN_INDEX_H
+#define __FONT24CN_INDEX_H
+
+#include "fonts.h"
+
+/* 26 code points of Font24CN_Table, ascending */
+static const CN_INDEX Font24CN_Index[] = {
+    {0x00041,  19}, /* A */
+    {0x00061,  20}, /* a */
+    {0x00062,  21}, /* b */
+    {0x00063,  22}, /* c */
+    {0x04E0B,   9}, /* 下 */
+    {0x04E3A,  15}, /* 为 */
+    {0x04F53,   8}, /* 体 */
+    {0x04F60,   0}, /* 你 */
+    {0x0597D,   1}, /* 好 */
+    {0x05B50,  26}, /* 子 */
+    {0x05B57,   7}, /* 字 */
+    {0x05BF9,  10}, /* 对 */
+    {0x05E94,  11}, /* 应 */
+    {0x05FAE,   2}, /* 微 */
+    {0x06811,  16}, /* 树 */
+    {0x06B64,   6}, /* 此 */
+    {0x06D3E,  18}, /* 派 */
+    {0x070B9,  13}, /* 点 */
+    {0x07535,  25}, /* 电 */
+    {0x07684,  12}, /* 的 */
+    {0x08393,  17}, /* 莓 */
+    {0x08F6F,   3}, /* 软 */
+    {0x09635,  14}, /* 阵 */
+    {0x096C5,   4}, /* 雅 */
+    {0x096EA,  24}, /* 雪 */
+    {0x09ED1,   5}, /* 黑 */
+};
+
+/* Ink box of each indexed glyph in the 32 x 41 cell: 2853 bytes instead of 4264 */
+static const CN_GLYPH Font24CN_Glyphs[] = {
+    {    0,  0,  8, 23, 25}, /* A */
+    {   75,  1, 15, 15, 18}, /* a */
+    {  111,  2,  7, 17, 26}, /* b */
+    {  189,  1, 15, 14, 18}, /* c */
+    {  225,  0,  8, 32, 28}, /* 下 */
+    {  337,  1,  7, 29, 30}, /* 为 */
+    {  457,  0,  7, 32, 30}, /* 体 */
+    {  577,  0,  7, 32, 29}, /* 你 */
+    {  693,  0,  6, 32, 30}, /* 好 */
+    {  813,  0,  8, 32, 28}, /* 子 */
+    {  925,  0,  5, 32, 31}, /* 字 */
+    { 1049,  0,  7, 32, 28}, /* 对 */
+    { 1161,  0,  5, 32, 32}, /* 应 */
+    { 1289,  0,  6, 32, 31}, /* 微 */
+    { 1413,  0,  7, 32, 30}, /* 树 */
+    { 1533,  0,  7, 32, 28}, /* 此 */
+    { 1645,  0,  7, 32, 30}, /* 派 */
+    { 1765,  0,  6, 32, 30}, /* 点 */
+    { 1885,  1,  6, 31, 30}, /* 电 */
+    { 2005,  1,  6, 30, 30}, /* 的 */
+    { 2125,  0,  6, 32, 31}, /* 莓 */
+    { 2249,  0,  5, 32, 32}, /* 软 */
+    { 2377,  1,  6, 31, 31}, /* 阵 */
+    { 2501,  0,  6, 32, 31}, /* 雅 */
+    { 2625,  1,  8, 30, 28}, /* 雪 */
+    { 2737,  0,  8, 32, 29}, /* 黑 */
+};
+
+static const uint8_t Font24CN_Bitmap[] = {
+    0x00, 0x7C, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFE, 0x00, 0x01, 0xFF, 0x00, 0x01,
+    0xFF, 0x00, 0x01, 0xEF, 0x00, 0x03, 0xEF, 0x80, 0x03, 0xCF, 0x80, 0x07, 0xC7, 0x80, 0x07, 0xC7,
+    0xC0, 0x07, 0x87, 0xC0, 0x0F, 0x83, 0xE0, 0x0F, 0x83, 0xE0, 0x0F, 0x01, 0xE0, 0x1F, 0xFF, 0xF0,
+    0x1F, 0xFF, 0xF0, 0x3F, 0xFF, 0xF8, 0x3E, 0x00, 0xF8, 0x3C, 0x00, 0xF8, 0x7C, 0x00, 0x7C, 0x7C,
+    0x00, 0x7C, 0x78, 0x00, 0x3C, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0x3E, 0x0F, 0xF0, 0x3F, 0xFC, 0x7F,
+    0xFC, 0x7C, 0x7E, 0x70, 0x3E, 0x00, 0x1E, 0x00, 0x1E, 0x07, 0xFE, 0x3F, 0xFE, 0x7F, 0x1E, 0xF8,
+    0x1E, 0xF8, 0x1E, 0xF0, 0x3E, 0xF8, 0x3E, 0xFC, 0xFE, 0xFF, 0xFE, 0x7F, 0xFE, 0x1F, 0x9E, 0xF0,
+    0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00,
+    0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF3, 0xF8, 0x00, 0xF7, 0xFE, 0x00, 0xFF, 0xFF, 0x00,
+    0xFE, 0x3F, 0x00, 0xFC, 0x1F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF0, 0x07, 0x80, 0xF0,
+    0x07, 0x80, 0xF0, 0x07, 0x80, 0xF0, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xF8, 0x0F, 0x80, 0xFC, 0x1F,
+    0x00, 0xFE, 0x3F, 0x00, 0xFF, 0xFE, 0x00, 0xFF, 0xFC, 0x00, 0xF3, 0xF0, 0x00, 0x03, 0xF8, 0x0F,
+    0xFC, 0x3F, 0xFC, 0x7F, 0x0C, 0x7C, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF0, 0x00, 0xF0,
+    0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x7F, 0x0C, 0x3F, 0xFC, 0x1F, 0xFC, 0x07,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80,
+    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80,
+    0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x0F, 0xBF,
+    0x00, 0x00, 0x0F, 0x9F, 0x80, 0x00, 0x0F, 0x87, 0xE0, 0x00, 0x0F, 0x83, 0xF0, 0x00, 0x0F, 0x80,
+    0xF8, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x0F, 0x80, 0x38, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80,
+    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80,
+    0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0x80,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x1C, 0x0F, 0x00, 0x00, 0x3E, 0x0F, 0x00, 0x00, 0x1F, 0x0F, 0x00,
+    0x00, 0x0F, 0x8F, 0x00, 0x00, 0x03, 0xCF, 0x00, 0x00, 0x01, 0x8F, 0x00, 0x00, 0x00, 0x0F, 0x00,
+    0x00, 0xFF, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F, 0x00, 0x78, 0x00, 0x1F, 0x00,
+    0x78, 0x00, 0x1E, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x78, 0x00, 0x1E, 0xC0, 0x78, 0x00, 0x3F, 0xE0,
+    0x78, 0x00, 0x3C, 0xF0, 0x78, 0x00, 0x7C, 0x78, 0x78, 0x00, 0x78, 0x7C, 0x78, 0x00, 0xF8, 0x3E,
+    0x78, 0x00, 0xF0, 0x1E, 0x78, 0x01, 0xF0, 0x0C, 0x78, 0x03, 0xE0, 0x00, 0x78, 0x07, 0xC0, 0x00,
+    0xF8, 0x0F, 0x80, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xF0, 0x3E, 0x00, 0x01, 0xF0, 0x7C, 0x01, 0xFF,
+    0xE0, 0xF8, 0x01, 0xFF, 0xC0, 0x70, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x3C, 0x00, 0x03, 0xC0, 0x3C,
+    0x00, 0x03, 0xC0, 0x3C, 0x00, 0x07, 0x80, 0x3C, 0x00, 0x07, 0x80, 0x3C, 0x00, 0x07, 0x80, 0x3C,
+    0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0x1F, 0x01, 0xFE, 0x00, 0x1F, 0x01, 0xFF,
+    0x00, 0x3F, 0x01, 0xFF, 0x00, 0x3F, 0x03, 0xFF, 0x00, 0x7F, 0x03, 0xFF, 0x80, 0x7F, 0x07, 0xBF,
+    0x80, 0xFF, 0x07, 0xBF, 0xC0, 0xEF, 0x0F, 0x3D, 0xC0, 0xCF, 0x0F, 0x3D, 0xE0, 0x0F, 0x1E, 0x3D,
+    0xE0, 0x0F, 0x1E, 0x3C, 0xF0, 0x0F, 0x3C, 0x3C, 0x78, 0x0F, 0x7C, 0x3C, 0x7C, 0x0F, 0xF8, 0x3C,
+    0x3E, 0x0F, 0xF7, 0xFF, 0xDF, 0x0F, 0xE7, 0xFF, 0xCF, 0x0F, 0xC0, 0x3C, 0x06, 0x0F, 0x00, 0x3C,
+    0x00, 0x0F, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x3C,
+    0x00, 0x01, 0xC1, 0xC0, 0x00, 0x01, 0xE3, 0xE0, 0x00, 0x03, 0xE3, 0xC0, 0x00, 0x03, 0xC7, 0x80,
+    0x00, 0x03, 0xC7, 0xFF, 0xFF, 0x07, 0x8F, 0xFF, 0xFF, 0x07, 0x8F, 0x00, 0x0F, 0x0F, 0x1E, 0x00,
+    0x1E, 0x0F, 0x3C, 0x1E, 0x1E, 0x1F, 0x3C, 0x1E, 0x3E, 0x1F, 0x18, 0x1E, 0x3C, 0x3F, 0x00, 0x1E,
+    0x1C, 0x7F, 0x00, 0x1E, 0x00, 0x7F, 0x07, 0x9E, 0x70, 0xFF, 0x07, 0x9E, 0xF0, 0xEF, 0x0F, 0x9E,
+    0x78, 0x6F, 0x0F, 0x1E, 0x78, 0x0F, 0x0F, 0x1E, 0x3C, 0x0F, 0x1E, 0x1E, 0x3C, 0x0F, 0x1E, 0x1E,
+    0x1E, 0x0F, 0x3C, 0x1E, 0x1E, 0x0F, 0x3C, 0x1E, 0x1F, 0x0F, 0x7C, 0x1E, 0x0F, 0x0F, 0x78, 0x1E,
+    0x0E, 0x0F, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x0F, 0x07, 0xFC,
+    0x00, 0x0F, 0x07, 0xF8, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x07, 0xFF,
+    0xFE, 0x0F, 0x07, 0xFF, 0xFE, 0x0F, 0x00, 0x00, 0x3E, 0x1E, 0x00, 0x00, 0xFC, 0xFF, 0xF8, 0x01,
+    0xF0, 0xFF, 0xF8, 0x03, 0xE0, 0x1E, 0x78, 0x07, 0xC0, 0x1E, 0x78, 0x0F, 0x80, 0x3C, 0x78, 0x0F,
+    0x00, 0x3C, 0x78, 0x0F, 0x00, 0x3C, 0x78, 0x0F, 0x00, 0x3C, 0x78, 0x0F, 0x00, 0x3C, 0x7F, 0xFF,
+    0xFF, 0x78, 0xFF, 0xFF, 0xFF, 0x78, 0xF0, 0x0F, 0x00, 0x78, 0xF0, 0x0F, 0x00, 0x3D, 0xE0, 0x0F,
+    0x00, 0x1F, 0xE0, 0x0F, 0x00, 0x0F, 0xE0, 0x0F, 0x00, 0x07, 0xC0, 0x0F, 0x00, 0x07, 0xE0, 0x0F,
+    0x00, 0x07, 0xF0, 0x0F, 0x00, 0x0F, 0xF8, 0x0F, 0x00, 0x1E, 0x7C, 0x0F, 0x00, 0x3C, 0x38, 0x0F,
+    0x00, 0x78, 0x00, 0x0F, 0x00, 0xF0, 0x03, 0xFF, 0x00, 0x60, 0x01, 0xFE, 0x00, 0x1F, 0xFF, 0xFF,
+    0xF8, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0F,
+    0xC0, 0x00, 0x00, 0x1F, 0x80, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x01, 0xF8,
+    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0,
+    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0,
+    0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xE0,
+    0x00, 0x00, 0x03, 0xC0, 0x00, 0x01, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x03, 0x80,
+    0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xE0,
+    0x00, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF, 0xFE, 0x78, 0x00, 0x00, 0x1E, 0x78, 0x00, 0x00,
+    0x1E, 0x78, 0x00, 0x00, 0x1E, 0x78, 0x00, 0x00, 0x1E, 0x7B, 0xFF, 0xFF, 0xDE, 0x03, 0xFF, 0xFF,
+    0xC0, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xF8,
+    0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01, 0xE0,
+    0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x03, 0xC0,
+    0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00,
+    0x78, 0x00, 0x00, 0x00, 0x78, 0x7F, 0xFC, 0x00, 0x78, 0x7F, 0xFC, 0x00, 0x78, 0x00, 0x3C, 0x00,
+    0x78, 0x00, 0x3F, 0xFF, 0xFF, 0x30, 0x3F, 0xFF, 0xFF, 0x78, 0x3C, 0x00, 0x78, 0x3C, 0x38, 0x00,
+    0x78, 0x3E, 0x78, 0x00, 0x78, 0x1E, 0x78, 0xC0, 0x78, 0x0F, 0x79, 0xE0, 0x78, 0x0F, 0xF0, 0xF0,
+    0x78, 0x07, 0xF0, 0xF8, 0x78, 0x03, 0xF0, 0x78, 0x78, 0x01, 0xE0, 0x3C, 0x78, 0x03, 0xF0, 0x3E,
+    0x78, 0x03, 0xF0, 0x18, 0x78, 0x07, 0xF8, 0x00, 0x78, 0x07, 0xFC, 0x00, 0x78, 0x0F, 0x3E, 0x00,
+    0x78, 0x1F, 0x1E, 0x00, 0x78, 0x3E, 0x1F, 0x00, 0x78, 0x7C, 0x0E, 0x00, 0xF8, 0xF8, 0x00, 0x00,
+    0xF0, 0xF0, 0x00, 0x3F, 0xF0, 0x60, 0x00, 0x3F, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x03, 0xE0,
+    0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x1F, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x1E, 0x01, 0xE0,
+    0x78, 0x1E, 0x01, 0xE0, 0x78, 0x1E, 0xE1, 0xE0, 0x78, 0x1F, 0xF1, 0xF0, 0xF8, 0x1E, 0xF0, 0xF0,
+    0xF0, 0x1E, 0xF0, 0xF0, 0xF0, 0x1E, 0xF8, 0xF0, 0xF0, 0x1E, 0x78, 0xF1, 0xF0, 0x1E, 0x78, 0xF9,
+    0xE0, 0x1E, 0x78, 0x79, 0xE0, 0x1E, 0x7C, 0x7B, 0xE0, 0x1E, 0x3C, 0x7B, 0xC0, 0x1E, 0x3C, 0x7B,
+    0xC0, 0x1E, 0x3C, 0x7B, 0xC0, 0x3C, 0x3E, 0x07, 0x80, 0x3C, 0x1C, 0x07, 0x80, 0x3C, 0x00, 0x07,
+    0x80, 0x3C, 0x00, 0x0F, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x7B, 0xFF, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF,
+    0xFF, 0xF0, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x03, 0x07, 0x01, 0xE0, 0x07, 0x87, 0x01,
+    0xE0, 0x07, 0x07, 0x01, 0xC0, 0x0F, 0xF7, 0x79, 0xC0, 0x1E, 0xF7, 0x7B, 0xC0, 0x1E, 0xF7, 0x7B,
+    0x80, 0x3C, 0xF7, 0x7B, 0xFF, 0x78, 0xF7, 0x7B, 0xFF, 0xF8, 0xF7, 0x7F, 0x9E, 0xF7, 0xFF, 0xFF,
+    0x9E, 0x67, 0xFF, 0xFF, 0x9E, 0x07, 0x00, 0x7F, 0x9C, 0x0F, 0x00, 0x0F, 0x9C, 0x1E, 0x00, 0x1F,
+    0x9C, 0x1E, 0x7F, 0xFF, 0xBC, 0x3E, 0x7F, 0xF3, 0xFC, 0x3E, 0x00, 0x03, 0xFC, 0x7E, 0x00, 0x01,
+    0xF8, 0xFE, 0x00, 0x01, 0xF8, 0xFE, 0x7F, 0xE1, 0xF8, 0xDE, 0x7F, 0xE1, 0xF8, 0x1E, 0x78, 0xE0,
+    0xF0, 0x1E, 0x78, 0xEE, 0xF0, 0x1E, 0x78, 0xFF, 0xF0, 0x1E, 0x78, 0xFD, 0xF8, 0x1E, 0x79, 0xFB,
+    0xFC, 0x1E, 0xF1, 0xF7, 0xBC, 0x1E, 0xF0, 0xEF, 0x9E, 0x1F, 0xE0, 0x0F, 0x0F, 0x1E, 0xC0, 0x1E,
+    0x0F, 0x1E, 0x00, 0x0C, 0x07, 0x0F, 0x00, 0x00, 0x38, 0x0F, 0x00, 0x00, 0x38, 0x0F, 0x00, 0x00,
+    0x38, 0x0F, 0x3F, 0xF8, 0x38, 0x0F, 0x3F, 0xF8, 0x38, 0x0F, 0x00, 0x78, 0x38, 0xFF, 0xE0, 0x7F,
+    0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0x0F, 0x00, 0x70, 0x38, 0x0F, 0x18, 0xF0, 0x38, 0x1F, 0x3C, 0xF0,
+    0x38, 0x1F, 0x1C, 0xFE, 0x38, 0x1F, 0xDE, 0xFE, 0x38, 0x3F, 0xEF, 0xEF, 0x38, 0x3F, 0xFF, 0xEF,
+    0x38, 0x3F, 0xF7, 0xE7, 0xB8, 0x7F, 0x67, 0xC7, 0xB8, 0x7F, 0x03, 0xC3, 0xB8, 0xFF, 0x07, 0xE0,
+    0x38, 0xEF, 0x07, 0xE0, 0x38, 0xEF, 0x0F, 0xF0, 0x38, 0xCF, 0x1F, 0xF0, 0x38, 0x0F, 0x1E, 0x78,
+    0x38, 0x0F, 0x3C, 0x7C, 0x38, 0x0F, 0x78, 0x3C, 0x38, 0x0F, 0xF8, 0x38, 0x38, 0x0F, 0x60, 0x00,
+    0x78, 0x0F, 0x00, 0x0F, 0xF8, 0x0F, 0x00, 0x07, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x78, 0x3C,
+    0x00, 0x00, 0x78, 0x3C, 0x00, 0x00, 0x78, 0x3C, 0x00, 0x00, 0x78, 0x3C, 0x00, 0x00, 0x78, 0x3C,
+    0x00, 0x00, 0x78, 0x3C, 0x0C, 0x3C, 0x78, 0x3C, 0x1E, 0x3C, 0x78, 0x3C, 0x3F, 0x3C, 0x78, 0x3C,
+    0xF8, 0x3C, 0x7F, 0xFD, 0xF0, 0x3C, 0x7F, 0xFF, 0xE0, 0x3C, 0x78, 0x3F, 0x80, 0x3C, 0x78, 0x3E,
+    0x00, 0x3C, 0x78, 0x3C, 0x00, 0x3C, 0x78, 0x3C, 0x00, 0x3C, 0x78, 0x3C, 0x00, 0x3C, 0x78, 0x3C,
+    0x00, 0x3C, 0x78, 0x3C, 0x00, 0x3C, 0x78, 0x3C, 0x00, 0x3C, 0x78, 0x3C, 0x0E, 0x3C, 0x78, 0x3C,
+    0x0F, 0x3C, 0x78, 0x3C, 0x0F, 0x3C, 0x79, 0xFC, 0x0F, 0x3C, 0x7F, 0xFC, 0x0F, 0x3F, 0xFF, 0x3C,
+    0x0F, 0x3F, 0xF0, 0x3E, 0x1E, 0xFF, 0x00, 0x1F, 0xFE, 0xF0, 0x00, 0x0F, 0xFC, 0x38, 0x00, 0x00,
+    0x3E, 0x7C, 0x00, 0x3F, 0xFE, 0x3F, 0x3F, 0xFF, 0xF0, 0x1F, 0xBF, 0xE0, 0x00, 0x07, 0xBC, 0x00,
+    0x00, 0x03, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x0F, 0xFE, 0x70, 0x3D, 0xFF,
+    0xF8, 0xF8, 0x3D, 0xFF, 0x00, 0x7C, 0x3D, 0xE7, 0x80, 0x3F, 0x3D, 0xE7, 0x80, 0x1F, 0x3D, 0xE7,
+    0x8E, 0x0E, 0x3D, 0xE7, 0x9F, 0x00, 0x3D, 0xE7, 0xFE, 0x00, 0x39, 0xE7, 0xF8, 0x00, 0x39, 0xE3,
+    0xF0, 0x1C, 0x39, 0xE3, 0xC0, 0x1E, 0x79, 0xE3, 0xC0, 0x1E, 0x79, 0xE1, 0xE0, 0x1E, 0x79, 0xE1,
+    0xE0, 0x3C, 0x79, 0xE0, 0xF0, 0x3C, 0x79, 0xE0, 0xF8, 0x3C, 0xF1, 0xE0, 0x7C, 0x3C, 0xF1, 0xE3,
+    0x7C, 0x7D, 0xF1, 0xEF, 0x3F, 0x79, 0xE1, 0xFE, 0x1F, 0x7B, 0xE1, 0xF8, 0x0E, 0x7B, 0xC3, 0xE0,
+    0x00, 0x79, 0x81, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x03, 0xC0,
+    0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x0F, 0xFF, 0xFF,
+    0xF8, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0x00, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x78, 0x0F, 0x00, 0x00,
+    0x78, 0x0F, 0x00, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x78, 0x0F, 0x00, 0x00, 0x78, 0x0F, 0xFF, 0xFF,
+    0xF8, 0x0F, 0xFF, 0xFF, 0xF8, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x38, 0x38,
+    0x30, 0x1E, 0x7C, 0x78, 0x78, 0x3E, 0x3C, 0x78, 0x78, 0x3C, 0x3C, 0x3C, 0x3C, 0x7C, 0x3E, 0x3C,
+    0x3E, 0xF8, 0x1E, 0x3C, 0x1E, 0xF0, 0x1E, 0x1E, 0x1F, 0x70, 0x1E, 0x1C, 0x0E, 0x00, 0x0F, 0x00,
+    0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x0F, 0x01, 0xF0, 0xF0, 0x0F, 0x01, 0xF0, 0xF0, 0x0F, 0x01,
+    0xF0, 0xF0, 0x0F, 0x01, 0xF0, 0xF0, 0x0F, 0x01, 0xF0, 0xF0, 0x0F, 0x01, 0xF0, 0xFF, 0xFF, 0xFF,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x0F, 0x01, 0xF0, 0xF0, 0x0F, 0x01, 0xF0, 0xF0, 0x0F, 0x01,
+    0xF0, 0xF0, 0x0F, 0x01, 0xF0, 0xF0, 0x0F, 0x01, 0xF0, 0xF0, 0x0F, 0x01, 0xF0, 0xFF, 0xFF, 0xFF,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x0F, 0x00, 0x1C, 0xF0, 0x0F, 0x00, 0x1E, 0x00, 0x0F, 0x00,
+    0x1E, 0x00, 0x0F, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x3E, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x07, 0xFF,
+    0xFC, 0x00, 0x03, 0xFF, 0xF8, 0x07, 0x00, 0x78, 0x00, 0x0F, 0x80, 0x7C, 0x00, 0x0F, 0x00, 0x78,
+    0x00, 0x0F, 0x00, 0xF8, 0x00, 0x1E, 0x00, 0xF0, 0x00, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFD, 0xFF,
+    0xFC, 0xF0, 0x3D, 0xE0, 0x3C, 0xF0, 0x3F, 0xC0, 0x3C, 0xF0, 0x3F, 0xC0, 0x3C, 0xF0, 0x3F, 0x80,
+    0x3C, 0xF0, 0x3F, 0x80, 0x3C, 0xF0, 0x3F, 0xE0, 0x3C, 0xF0, 0x3D, 0xF0, 0x3C, 0xF0, 0x3C, 0xF8,
+    0x3C, 0xFF, 0xFC, 0x78, 0x3C, 0xFF, 0xFC, 0x3C, 0x3C, 0xF0, 0x3C, 0x3E, 0x3C, 0xF0, 0x3C, 0x1F,
+    0x3C, 0xF0, 0x3C, 0x0F, 0x3C, 0xF0, 0x3C, 0x0E, 0x3C, 0xF0, 0x3C, 0x00, 0x3C, 0xF0, 0x3C, 0x00,
+    0x3C, 0xF0, 0x3C, 0x00, 0x7C, 0xF0, 0x3C, 0x00, 0x78, 0xF0, 0x3C, 0x00, 0x78, 0xFF, 0xFC, 0x00,
+    0x78, 0xFF, 0xFC, 0x00, 0xF8, 0xF0, 0x3C, 0x7F, 0xF0, 0xF0, 0x3C, 0x7F, 0xE0, 0x00, 0x3C, 0x1E,
+    0x00, 0x00, 0x3C, 0x1E, 0x00, 0x00, 0x3C, 0x1E, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x3C, 0x1E, 0x00, 0x07, 0xBC, 0x1E, 0x00, 0x07, 0x80, 0x00, 0x00, 0x0F, 0xFF, 0xFF,
+    0xFC, 0x0F, 0xFF, 0xFF, 0xFC, 0x1E, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00,
+    0x00, 0x7F, 0xFF, 0xFF, 0xF0, 0xF7, 0xFF, 0xFF, 0xF0, 0x37, 0x83, 0x80, 0xF0, 0x07, 0x87, 0xC0,
+    0xF0, 0x07, 0x83, 0xF0, 0xF0, 0x07, 0x00, 0xE0, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0F, 0x0F, 0x00, 0xE0, 0x0F, 0x0F, 0x81, 0xE0, 0x0E, 0x03, 0xE1, 0xE0, 0x1E, 0x01, 0xC1,
+    0xE0, 0x1F, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x03,
+    0xC0, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0x80, 0x03, 0xC0, 0x78, 0x00, 0x07, 0x80, 0x78,
+    0x00, 0x07, 0x80, 0x78, 0x00, 0x07, 0x80, 0xF0, 0x00, 0x0F, 0x00, 0xF0, 0x00, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x03, 0xC0, 0x1F, 0x1E, 0x03, 0xC0, 0x1E, 0x1F, 0xE7, 0x8F,
+    0x3E, 0x3D, 0xE7, 0x8F, 0x3C, 0x3D, 0xEF, 0x0F, 0x7C, 0x3D, 0xE7, 0x0F, 0x78, 0x79, 0xE0, 0x0F,
+    0x00, 0x79, 0xE0, 0x0E, 0x00, 0x7F, 0xFE, 0x0E, 0x00, 0x7F, 0xFE, 0x1F, 0x00, 0x01, 0xE0, 0x1F,
+    0x00, 0x01, 0xE0, 0x1F, 0x00, 0x01, 0xE0, 0x1F, 0x80, 0x01, 0xE0, 0x1F, 0x80, 0x01, 0xE0, 0x3F,
+    0x80, 0x01, 0xFF, 0x3F, 0xC0, 0x0F, 0xFF, 0x7B, 0xC0, 0xFF, 0xF0, 0x79, 0xE0, 0xF9, 0xE0, 0xF1,
+    0xF0, 0x01, 0xE1, 0xF0, 0xF0, 0x01, 0xE3, 0xE0, 0xF8, 0x01, 0xE7, 0xC0, 0x7C, 0x01, 0xFF, 0x80,
+    0x3F, 0x01, 0xFF, 0x00, 0x1F, 0x01, 0xEC, 0x00, 0x0E, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0xF0,
+    0x00, 0xFF, 0xE0, 0xF0, 0x00, 0xFF, 0xE0, 0xF0, 0x00, 0xF3, 0xFF, 0xFF, 0xFE, 0xF3, 0xFF, 0xFF,
+    0xFE, 0xF3, 0xC3, 0xC0, 0x00, 0xF3, 0xC3, 0xC0, 0x00, 0xF7, 0x83, 0xDF, 0x00, 0xF7, 0x87, 0x9F,
+    0x00, 0xF7, 0x87, 0x9F, 0x00, 0xFF, 0x0F, 0x9F, 0x00, 0xFF, 0x0F, 0x1F, 0x00, 0xFF, 0x0F, 0x1F,
+    0x00, 0xF7, 0x9E, 0x1F, 0x00, 0xF7, 0x9F, 0xFF, 0xFC, 0xF3, 0xDF, 0xFF, 0xFC, 0xF3, 0xC0, 0x1F,
+    0x00, 0xF1, 0xC0, 0x1F, 0x00, 0xF1, 0xE0, 0x1F, 0x00, 0xF1, 0xE0, 0x1F, 0x00, 0xF1, 0xE0, 0x1F,
+    0x00, 0xF1, 0xFF, 0xFF, 0xFE, 0xF3, 0xFF, 0xFF, 0xFE, 0xFF, 0xC0, 0x1F, 0x00, 0xFF, 0x80, 0x1F,
+    0x00, 0xF0, 0x00, 0x1F, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0xF0, 0x00, 0x1F, 0x00, 0xF0, 0x00, 0x1F,
+    0x00, 0xF0, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x7F, 0xFC, 0xF7,
+    0x80, 0x7F, 0xFD, 0xE3, 0xC0, 0x01, 0xC1, 0xE3, 0xC0, 0x01, 0xC3, 0xC1, 0x80, 0x3D, 0xC7, 0xFF,
+    0xFF, 0x39, 0xC7, 0xFF, 0xFF, 0x39, 0xCF, 0x83, 0x80, 0x79, 0xDF, 0x83, 0x80, 0x79, 0xFF, 0x83,
+    0x80, 0x79, 0xDF, 0x83, 0x80, 0x71, 0xC3, 0x83, 0x80, 0x7F, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFF,
+    0xFE, 0x03, 0xC3, 0x83, 0x80, 0x07, 0xC3, 0x83, 0x80, 0x07, 0xC3, 0x83, 0x80, 0x0F, 0xC3, 0x83,
+    0x80, 0x0F, 0xC3, 0x83, 0x80, 0x1F, 0xC3, 0xFF, 0xFE, 0x1D, 0xC3, 0xFF, 0xFE, 0x3D, 0xC3, 0x83,
+    0x80, 0x79, 0xC3, 0x83, 0x80, 0xF1, 0xC3, 0x83, 0x80, 0xF1, 0xC3, 0x83, 0x80, 0x61, 0xC3, 0x83,
+    0x80, 0x01, 0xC3, 0xFF, 0xFF, 0x03, 0xC3, 0xFF, 0xFF, 0x1F, 0xC3, 0x80, 0x00, 0x1F, 0x83, 0x80,
+    0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x80,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xF0, 0x07, 0x80, 0x3C, 0xF0, 0x07, 0x80,
+    0x3C, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0x80, 0x00, 0x00, 0x07, 0x80,
+    0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
+    0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x3F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00,
+    0xF0, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+    0xF0, 0x1F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFC, 0x1E, 0x03, 0xC0, 0x3C, 0x1E, 0xC3, 0xC7,
+    0x3C, 0x1F, 0xE3, 0xC7, 0xBC, 0x1E, 0xF3, 0xCF, 0x3C, 0x1E, 0xFB, 0xDF, 0x3C, 0x1E, 0x7B, 0xDE,
+    0x3C, 0x1E, 0x33, 0xDC, 0x3C, 0x1E, 0x03, 0xC0, 0x3C, 0x1F, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF,
+    0xFC, 0x1E, 0x03, 0xC0, 0x3C, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x3F, 0xFF, 0xFF,
+    0xFC, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x03, 0xC0,
+    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x38, 0x70,
+    0x70, 0x3E, 0x78, 0xF8, 0xF8, 0x3C, 0x7C, 0x78, 0x7C, 0x7C, 0x3C, 0x3C, 0x3E, 0xF8, 0x3E, 0x3C,
+    0x1F, 0xF0, 0x1C, 0x18, 0x0E,
+};
+
+#endif
@@ -0,0 +1,117 @@
+/* Generated by font_pack.py from font24.c, do not edit */
+#ifndef __FONT24_PACKED_H
+#define __FONT24_PACKED_H
+
+#include "fonts.h"
+
+/* 17 x 24, 2342 bytes instead of 6840 */
+static const uint8_t Font24_Packed[] = {
+    0x00, 0x00, 0x00, 0x00, // ' '
+    0x06, 0x02, 0x03, 0x0F, 0xFF, 0xFF, 0xFF, 0xE9, 0x01, 0xF8, // '!'
+    0x04, 0x03, 0x08, 0x07, 0xE7, 0xE7, 0xE7, 0x42, 0x42, 0x42, 0x42, // '"'
+    0x02, 0x02, 0x0B, 0x10, 0x19, 0x83, 0x30, 0x66, 0x0C, 0xC1, 0x99, 0xFF, 0xFF, 0xF8, 0xCC, 0x33, 0x1F, 0xFF, 0xFF, 0x99, 0x83, 0x30, 0x66, 0x0C, 0xC1, 0x98, // '#'
+    0x03, 0x01, 0x09, 0x13, 0x0C, 0x06, 0x0F, 0x6F, 0xFC, 0x3E, 0x1F, 0x80, 0xF8, 0x3F, 0x03, 0xF0, 0x7C, 0x3E, 0x3F, 0xFB, 0x78, 0x18, 0x0C, 0x06, 0x03, 0x00, // '$'
+    0x03, 0x02, 0x0A, 0x0F, 0x3C, 0x1F, 0x8E, 0x73, 0x0C, 0xC3, 0x39, 0xC7, 0xFC, 0xFC, 0xFF, 0x8E, 0x73, 0x0C, 0xC3, 0x39, 0xC7, 0xE0, 0xF0, // '%'
+    0x03, 0x04, 0x0B, 0x0D, 0x1F, 0x87, 0xF1, 0x8C, 0x30, 0x06, 0x00, 0x60, 0x0E, 0x03, 0xE7, 0xEF, 0xF8, 0xF3, 0x0E, 0x3F, 0xF3, 0xEE, // '&'
+    0x06, 0x03, 0x03, 0x07, 0xFF, 0xA4, 0x90, // '''
+    0x07, 0x02, 0x06, 0x12, 0x0C, 0x73, 0x9E, 0x71, 0xCE, 0x38, 0xE3, 0x8E, 0x38, 0x71, 0xC3, 0x8E, 0x1C, 0x30, // '('
+    0x03, 0x02, 0x06, 0x12, 0xC3, 0x87, 0x1C, 0x38, 0xE1, 0xC7, 0x1C, 0x71, 0xC7, 0x38, 0xE7, 0x9C, 0xE3, 0x00, // ')'
+    0x03, 0x02, 0x0A, 0x0A, 0x0C, 0x03, 0x00, 0xC3, 0xB7, 0xFF, 0xCF, 0xC1, 0xE0, 0x78, 0x33, 0x0C, 0xC0, // '*'
+    0x02, 0x04, 0x0C, 0x0C, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x0F, 0xFF, 0xFF, 0xF0, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, // '+'
+    0x06, 0x0E, 0x05, 0x07, 0x39, 0x9C, 0xC6, 0x63, 0x00, // ','
+    0x03, 0x09, 0x0A, 0x02, 0xFF, 0xFF, 0xF0, // '-'
+    0x06, 0x0E, 0x04, 0x03, 0xFF, 0xF0, // '.'
+    0x03, 0x00, 0x0A, 0x14, 0x00, 0xC0, 0x30, 0x1C, 0x06, 0x03, 0x80, 0xC0, 0x30, 0x18, 0x06, 0x03, 0x00, 0xC0, 0x60, 0x18, 0x0C, 0x03, 0x01, 0xC0, 0x60, 0x38, 0x0C, 0x03, 0x00, // '/'
+    0x03, 0x02, 0x0A, 0x0F, 0x1E, 0x0F, 0xC6, 0x19, 0x86, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0D, 0x86, 0x61, 0x8F, 0xC1, 0xE0, // '0'
+    0x03, 0x02, 0x0A, 0x0F, 0x04, 0x0F, 0x0F, 0xC3, 0xB0, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x3F, 0xFF, 0xFC, // '1'
+    0x02, 0x02, 0x0B, 0x0F, 0x1F, 0x0F, 0xFB, 0x83, 0x60, 0x3C, 0x06, 0x00, 0xC0, 0x30, 0x0C, 0x07, 0x01, 0xC0, 0x60, 0x18, 0x06, 0x01, 0xFF, 0xFF, 0xF8, // '2'
+    0x03, 0x02, 0x0A, 0x0F, 0x1E, 0x1F, 0xC6, 0x38, 0x06, 0x01, 0x80, 0xC1, 0xE0, 0x7C, 0x03, 0x80, 0x30, 0x0C, 0x03, 0xC1, 0xFF, 0xE7, 0xE0, // '3'
+    0x02, 0x02, 0x0B, 0x0F, 0x03, 0x80, 0xF0, 0x1E, 0x06, 0xC1, 0x98, 0x33, 0x0C, 0x61, 0x8C, 0x61, 0x98, 0x33, 0xFF, 0xFF, 0xF0, 0x18, 0x1F, 0xC3, 0xF8, // '4'
+    0x02, 0x02, 0x0B, 0x0F, 0x7F, 0xCF, 0xF9, 0x80, 0x30, 0x06, 0x00, 0xDE, 0x1F, 0xF3, 0x86, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x3C, 0x0D, 0xFF, 0x8F, 0xC0, // '5'
+    0x03, 0x02, 0x0A, 0x0F, 0x07, 0xC7, 0xF3, 0x81, 0xC0, 0x60, 0x30, 0x0D, 0xE3, 0xFE, 0xE1, 0xB0, 0x3C, 0x0F, 0x03, 0x61, 0xDF, 0xE1, 0xF0, // '6'
+    0x03, 0x02, 0x0A, 0x0F, 0xFF, 0xFF, 0xFC, 0x0F, 0x07, 0x01, 0x80, 0x60, 0x38, 0x0C, 0x03, 0x01, 0xC0, 0x60, 0x18, 0x0E, 0x03, 0x00, 0xC0, // '7'
+    0x03, 0x02, 0x0A, 0x0F, 0x3F, 0x1F, 0xEE, 0x1F, 0x03, 0xC0, 0xD8, 0x63, 0xF0, 0xFC, 0x61, 0xB0, 0x3C, 0x0F, 0x03, 0xE1, 0xDF, 0xE3, 0xF0, // '8'
+    0x03, 0x02, 0x0A, 0x0F, 0x3E, 0x1F, 0xEE, 0x1B, 0x03, 0xC0, 0xF0, 0x36, 0x1D, 0xFF, 0x1E, 0xC0, 0x30, 0x18, 0x0E, 0x07, 0x3F, 0x8F, 0x80, // '9'
+    0x06, 0x06, 0x04, 0x0B, 0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF0, // ':'
+    0x06, 0x06, 0x06, 0x0D, 0x3C, 0xF3, 0xC0, 0x00, 0x00, 0x0E, 0x71, 0x86, 0x30, 0x80, // ';'
+    0x00, 0x04, 0x0E, 0x0D, 0x00, 0x1C, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1C, // '<'
+    0x01, 0x07, 0x0D, 0x06, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, // '='
+    0x01, 0x04, 0x0E, 0x0D, 0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x00, 0xE0, 0x00, // '>'
+    0x03, 0x03, 0x09, 0x0E, 0x3E, 0x3F, 0xB0, 0xF8, 0x3C, 0x18, 0x1C, 0x1C, 0x3C, 0x1C, 0x0C, 0x00, 0x00, 0x03, 0x81, 0xC0, // '?'
+    0x03, 0x02, 0x0A, 0x11, 0x1F, 0x0F, 0xE7, 0x1D, 0x83, 0xC3, 0xF1, 0xFC, 0xEF, 0x33, 0xCC, 0xF3, 0x3C, 0x7F, 0x0F, 0xC0, 0x18, 0x07, 0x0C, 0xFF, 0x1F, 0x00, // '@'
+    0x00, 0x03, 0x10, 0x0E, 0x1F, 0x80, 0x1F, 0xC0, 0x01, 0xC0, 0x03, 0x60, 0x03, 0x60, 0x06, 0x30, 0x06, 0x30, 0x0C, 0x30, 0x0F, 0xF8, 0x1F, 0xF8, 0x18, 0x0C, 0x30, 0x0C, 0xFC, 0x7F, 0xFC, 0x7F, // 'A'
+    0x01, 0x03, 0x0D, 0x0E, 0xFF, 0xC7, 0xFF, 0x0C, 0x1C, 0x60, 0x63, 0x03, 0x18, 0x38, 0xFF, 0x87, 0xFE, 0x30, 0x39, 0x80, 0xCC, 0x06, 0x60, 0x3F, 0xFF, 0x7F, 0xF0, // 'B'
+    0x02, 0x03, 0x0C, 0x0E, 0x0F, 0xB3, 0xFF, 0x70, 0x76, 0x03, 0xC0, 0x3C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0x60, 0x37, 0x07, 0x3F, 0xE0, 0xFC, // 'C'
+    0x01, 0x03, 0x0D, 0x0E, 0xFF, 0x87, 0xFF, 0x0C, 0x1C, 0x60, 0x63, 0x01, 0x98, 0x0C, 0xC0, 0x66, 0x03, 0x30, 0x19, 0x80, 0xCC, 0x0C, 0x60, 0xEF, 0xFE, 0x7F, 0xE0, // 'D'
+    0x01, 0x03, 0x0C, 0x0E, 0xFF, 0xFF, 0xFF, 0x30, 0x33, 0x03, 0x33, 0x33, 0x30, 0x3F, 0x03, 0xF0, 0x33, 0x03, 0x33, 0x30, 0x33, 0x03, 0xFF, 0xFF, 0xFF, // 'E'
+    0x02, 0x03, 0x0C, 0x0E, 0xFF, 0xFF, 0xFF, 0x30, 0x33, 0x03, 0x33, 0x33, 0x30, 0x3F, 0x03, 0xF0, 0x33, 0x03, 0x30, 0x30, 0x03, 0x00, 0xFF, 0x0F, 0xF0, // 'F'
+    0x02, 0x03, 0x0D, 0x0E, 0x0F, 0xB1, 0xFF, 0x9C, 0x1C, 0xC0, 0x6C, 0x03, 0x60, 0x03, 0x00, 0x18, 0x7F, 0xC3, 0xFE, 0x01, 0xB8, 0x0C, 0xE0, 0xE3, 0xFF, 0x07, 0xE0, // 'G'
+    0x01, 0x03, 0x0E, 0x0E, 0xFC, 0xFF, 0xF3, 0xF3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0xFF, 0x0F, 0xFC, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0xFC, 0xFF, 0xF3, 0xF0, // 'H'
+    0x03, 0x03, 0x0A, 0x0E, 0xFF, 0xFF, 0xF0, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0xFF, 0xFF, 0xF0, // 'I'
+    0x02, 0x03, 0x0D, 0x0E, 0x1F, 0xF8, 0xFF, 0xC0, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x18, 0x18, 0xC0, 0xC6, 0x06, 0x30, 0x31, 0x83, 0x0F, 0xF8, 0x1F, 0x00, // 'J'
+    0x01, 0x03, 0x0F, 0x0E, 0xFE, 0x7D, 0xFC, 0xF8, 0xC1, 0x81, 0x86, 0x03, 0x18, 0x06, 0x60, 0x0D, 0xC0, 0x1F, 0xC0, 0x39, 0xC0, 0x61, 0xC0, 0xC1, 0x81, 0x83, 0x8F, 0xE3, 0xFF, 0xC7, 0xC0, // 'K'
+    0x01, 0x03, 0x0D, 0x0E, 0xFF, 0x07, 0xF8, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x18, 0x18, 0xC0, 0xC6, 0x06, 0x30, 0x3F, 0xFF, 0xFF, 0xFC, // 'L'
+    0x00, 0x03, 0x10, 0x0E, 0xF0, 0x0F, 0xF8, 0x1F, 0x38, 0x1C, 0x3C, 0x3C, 0x3C, 0x3C, 0x36, 0x6C, 0x36, 0x6C, 0x33, 0xCC, 0x33, 0xCC, 0x31, 0x8C, 0x30, 0x0C, 0x30, 0x0C, 0xFE, 0x7F, 0xFE, 0x7F, // 'M'
+    0x01, 0x03, 0x0E, 0x0E, 0xF1, 0xFF, 0xC7, 0xF3, 0x83, 0x0F, 0x0C, 0x3E, 0x30, 0xD8, 0xC3, 0x73, 0x0C, 0xEC, 0x31, 0xB0, 0xC7, 0xC3, 0x0F, 0x0C, 0x1C, 0xFE, 0x33, 0xF8, 0xC0, // 'N'
+    0x02, 0x03, 0x0C, 0x0E, 0x0F, 0x03, 0xFC, 0x70, 0xE6, 0x06, 0xE0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x07, 0x60, 0x67, 0x0E, 0x3F, 0xC0, 0xF0, // 'O'
+    0x02, 0x03, 0x0C, 0x0E, 0xFF, 0xCF, 0xFE, 0x30, 0x73, 0x03, 0x30, 0x33, 0x03, 0x30, 0x63, 0xFE, 0x3F, 0x83, 0x00, 0x30, 0x03, 0x00, 0xFF, 0x0F, 0xF0, // 'P'
+    0x02, 0x03, 0x0C, 0x11, 0x0F, 0x03, 0xFC, 0x70, 0xE6, 0x06, 0xE0, 0x7C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x07, 0x60, 0x67, 0x0E, 0x3F, 0xC1, 0xF0, 0x1F, 0x33, 0xFF, 0x30, 0xE0, // 'Q'
+    0x01, 0x03, 0x0E, 0x0E, 0xFF, 0xC3, 0xFF, 0x83, 0x07, 0x0C, 0x0C, 0x30, 0x30, 0xC1, 0xC3, 0xFE, 0x0F, 0xE0, 0x31, 0xC0, 0xC3, 0x83, 0x06, 0x0C, 0x1C, 0xFE, 0x3F, 0xF8, 0x70, // 'R'
+    0x03, 0x03, 0x0A, 0x0E, 0x3E, 0xDF, 0xFE, 0x1F, 0x03, 0xC0, 0xFC, 0x07, 0xE0, 0x7E, 0x03, 0xF0, 0x3C, 0x0F, 0x87, 0xFF, 0xB7, 0xC0, // 'S'
+    0x02, 0x03, 0x0C, 0x0E, 0xFF, 0xFF, 0xFF, 0xC6, 0x3C, 0x63, 0xC6, 0x3C, 0x63, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x3F, 0xC3, 0xFC, // 'T'
+    0x01, 0x03, 0x0E, 0x0E, 0xFC, 0xFF, 0xF3, 0xF3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x06, 0x18, 0x1F, 0xE0, 0x1E, 0x00, // 'U'
+    0x01, 0x03, 0x0F, 0x0E, 0xFE, 0xFF, 0xFD, 0xFC, 0xC0, 0x60, 0xC1, 0x81, 0x83, 0x03, 0x06, 0x03, 0x18, 0x06, 0x30, 0x06, 0xC0, 0x0D, 0x80, 0x1B, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x20, 0x00, // 'V'
+    0x00, 0x03, 0x11, 0x0E, 0xFE, 0x3F, 0xFF, 0x1F, 0xCC, 0x01, 0x86, 0x00, 0xC3, 0x08, 0x60, 0xCE, 0x60, 0x67, 0x30, 0x36, 0xD8, 0x1B, 0x6C, 0x0F, 0x3E, 0x03, 0x8E, 0x01, 0xC7, 0x00, 0xC1, 0x80, 0x60, 0xC0, // 'W'
+    0x01, 0x03, 0x0E, 0x0E, 0xFC, 0xFF, 0xF3, 0xF3, 0x03, 0x06, 0x18, 0x0C, 0xC0, 0x1E, 0x00, 0x30, 0x00, 0xC0, 0x07, 0x80, 0x33, 0x01, 0x86, 0x0C, 0x0C, 0xFC, 0xFF, 0xF3, 0xF0, // 'X'
+    0x01, 0x03, 0x0E, 0x0E, 0xF8, 0xFF, 0xE3, 0xF3, 0x03, 0x06, 0x18, 0x0C, 0xC0, 0x33, 0x00, 0x78, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x1F, 0xE0, 0x7F, 0x80, // 'Y'
+    0x02, 0x03, 0x0B, 0x0E, 0x7F, 0xEF, 0xFD, 0x81, 0xB0, 0x66, 0x18, 0xC6, 0x01, 0x80, 0x60, 0x18, 0x66, 0x0D, 0x81, 0xE0, 0x3F, 0xFF, 0xFF, 0xC0, // 'Z'
+    0x07, 0x02, 0x05, 0x12, 0xFF, 0xF1, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xFF, 0xC0, // '['
+    0x03, 0x00, 0x0A, 0x14, 0xC0, 0x30, 0x0E, 0x01, 0x80, 0x70, 0x0C, 0x03, 0x00, 0x60, 0x18, 0x03, 0x00, 0xC0, 0x18, 0x06, 0x00, 0xC0, 0x30, 0x0E, 0x01, 0x80, 0x70, 0x0C, 0x03, // '\'
+    0x04, 0x02, 0x05, 0x12, 0xFF, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0xFF, 0xC0, // ']'
+    0x03, 0x01, 0x0B, 0x08, 0x04, 0x01, 0xC0, 0x7C, 0x1D, 0xC3, 0x18, 0xC1, 0xB0, 0x1C, 0x01, // '^'
+    0x00, 0x16, 0x10, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, // '_'
+    0x06, 0x01, 0x05, 0x04, 0xC7, 0x0E, 0x30, // '`'
+    0x02, 0x06, 0x0C, 0x0B, 0x3F, 0x07, 0xF8, 0x00, 0xC0, 0x0C, 0x1F, 0xC7, 0xFC, 0xE0, 0xCC, 0x0C, 0xC1, 0xC7, 0xFF, 0x3E, 0xF0, // 'a'
+    0x01, 0x02, 0x0D, 0x0F, 0xF0, 0x07, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x7C, 0x1F, 0xF8, 0xE0, 0xC6, 0x03, 0x30, 0x19, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x83, 0x7F, 0xFB, 0xDF, 0x00, // 'b'
+    0x02, 0x06, 0x0C, 0x0B, 0x0F, 0xB3, 0xFF, 0x70, 0x7E, 0x03, 0xC0, 0x3C, 0x00, 0xC0, 0x0E, 0x03, 0x70, 0x73, 0xFE, 0x0F, 0xC0, // 'c'
+    0x02, 0x02, 0x0D, 0x0F, 0x01, 0xE0, 0x0F, 0x00, 0x18, 0x00, 0xC1, 0xF6, 0x3F, 0xF1, 0x83, 0x98, 0x0C, 0xC0, 0x66, 0x03, 0x30, 0x19, 0x80, 0xC6, 0x0E, 0x3F, 0xFC, 0x7D, 0xE0, // 'd'
+    0x02, 0x06, 0x0C, 0x0B, 0x1F, 0x87, 0xFE, 0x60, 0x6C, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0C, 0x00, 0x60, 0x37, 0xFF, 0x1F, 0xC0, // 'e'
+    0x02, 0x02, 0x0C, 0x0F, 0x07, 0xF0, 0xFF, 0x18, 0x01, 0x80, 0xFF, 0xEF, 0xFE, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x0F, 0xFC, 0xFF, 0xC0, // 'f'
+    0x02, 0x06, 0x0D, 0x10, 0x1F, 0x7B, 0xFF, 0xD8, 0x39, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x01, 0x98, 0x0C, 0x60, 0xE3, 0xFF, 0x07, 0xD8, 0x00, 0xC0, 0x06, 0x00, 0x70, 0xFF, 0x07, 0xE0, // 'g'
+    0x01, 0x02, 0x0E, 0x0F, 0xF0, 0x03, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x37, 0xC0, 0xFF, 0x83, 0x87, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x33, 0xF3, 0xFF, 0xCF, 0xC0, // 'h'
+    0x02, 0x02, 0x0C, 0x0F, 0x06, 0x00, 0x60, 0x00, 0x00, 0x00, 0x7E, 0x07, 0xE0, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x0F, 0xFF, 0xFF, 0xF0, // 'i'
+    0x03, 0x02, 0x09, 0x14, 0x06, 0x03, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x81, 0xFF, 0xDF, 0x80, // 'j'
+    0x02, 0x02, 0x0C, 0x0F, 0xF0, 0x0F, 0x00, 0x30, 0x03, 0x00, 0x33, 0xE3, 0x3E, 0x33, 0x03, 0x60, 0x3E, 0x03, 0xC0, 0x3E, 0x03, 0x70, 0x33, 0x8F, 0x1F, 0xF1, 0xF0, // 'k'
+    0x02, 0x02, 0x0C, 0x0F, 0x7E, 0x07, 0xE0, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x0F, 0xFF, 0xFF, 0xF0, // 'l'
+    0x00, 0x06, 0x10, 0x0B, 0xF7, 0x78, 0xFF, 0xFC, 0x39, 0xCC, 0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C, 0xFD, 0xEF, 0xFD, 0xEF, // 'm'
+    0x01, 0x06, 0x0E, 0x0B, 0xF7, 0xC3, 0xFF, 0x83, 0x87, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x33, 0xF3, 0xFF, 0xCF, 0xC0, // 'n'
+    0x02, 0x06, 0x0C, 0x0B, 0x0F, 0x03, 0xFC, 0x70, 0xEE, 0x07, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x07, 0x70, 0xE3, 0xFC, 0x0F, 0x00, // 'o'
+    0x01, 0x06, 0x0D, 0x10, 0xF7, 0xC7, 0xFF, 0x8E, 0x0C, 0x60, 0x33, 0x01, 0x98, 0x0C, 0xC0, 0x66, 0x03, 0x38, 0x31, 0xFF, 0x8D, 0xF0, 0x60, 0x03, 0x00, 0x18, 0x03, 0xF8, 0x1F, 0xC0, // 'p'
+    0x02, 0x06, 0x0D, 0x10, 0x1F, 0x7B, 0xFF, 0xD8, 0x39, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x01, 0x98, 0x0C, 0x60, 0xE3, 0xFF, 0x07, 0xD8, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x0F, 0xE0, 0x7F, // 'q'
+    0x02, 0x06, 0x0C, 0x0B, 0xF9, 0xEF, 0xBF, 0x1F, 0x31, 0xC0, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x0F, 0xFC, 0xFF, 0xC0, // 'r'
+    0x03, 0x06, 0x0A, 0x0B, 0x3F, 0xDF, 0xFC, 0x0F, 0x03, 0xFC, 0x1F, 0xE0, 0x7F, 0x03, 0xC1, 0xFF, 0xEF, 0xF0, // 's'
+    0x02, 0x02, 0x0C, 0x0F, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0xFF, 0xCF, 0xFC, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x71, 0xFF, 0x0F, 0xC0, // 't'
+    0x01, 0x06, 0x0E, 0x0B, 0xF0, 0xF3, 0xC3, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x70, 0x7F, 0xF0, 0xFB, 0xC0, // 'u'
+    0x01, 0x06, 0x0E, 0x0B, 0xF8, 0x7F, 0xE1, 0xF3, 0x03, 0x0C, 0x0C, 0x18, 0x60, 0x61, 0x80, 0xCC, 0x03, 0x30, 0x0F, 0xC0, 0x1E, 0x00, 0x78, 0x00, // 'v'
+    0x01, 0x06, 0x0D, 0x0B, 0xF0, 0x7F, 0x83, 0xD8, 0x8C, 0xCE, 0x66, 0x73, 0x1A, 0xB0, 0xF7, 0x87, 0xBC, 0x38, 0xC0, 0xC6, 0x06, 0x30, // 'w'
+    0x02, 0x06, 0x0C, 0x0B, 0xF9, 0xFF, 0x9F, 0x30, 0xC1, 0x98, 0x0F, 0x00, 0x60, 0x0F, 0x01, 0x98, 0x30, 0xCF, 0x9F, 0xF9, 0xF0, // 'x'
+    0x01, 0x06, 0x0F, 0x10, 0xFC, 0x3F, 0xF8, 0x7C, 0xC0, 0x60, 0xC1, 0x81, 0x83, 0x01, 0x8C, 0x03, 0x18, 0x03, 0x60, 0x07, 0xC0, 0x07, 0x00, 0x06, 0x00, 0x18, 0x00, 0x30, 0x00, 0xC0, 0x1F, 0xE0, 0x3F, 0xC0, // 'y'
+    0x03, 0x06, 0x0A, 0x0B, 0xFF, 0xFF, 0xFC, 0x1B, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC3, 0x60, 0xFF, 0xFF, 0xFC, // 'z'
+    0x05, 0x02, 0x06, 0x12, 0x1C, 0xF3, 0x0C, 0x30, 0xC3, 0x0C, 0x73, 0x87, 0x0C, 0x30, 0xC3, 0x0C, 0x3C, 0x70, // '{'
+    0x07, 0x02, 0x02, 0x12, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, // '|'
+    0x05, 0x02, 0x06, 0x12, 0xE3, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x38, 0x73, 0x8C, 0x30, 0xC3, 0x0C, 0xF3, 0x80, // '}'
+    0x02, 0x08, 0x0B, 0x05, 0x38, 0x0F, 0x8F, 0xBB, 0xE3, 0xE0, 0x38, // '~'
+};
+
+static const uint16_t Font24_Offsets[96] = {
+        0,     4,    14,    25,    51,    77,   100,   122,   129,   147,   165,   182,
+      204,   213,   220,   226,   255,   278,   301,   326,   349,   374,   399,   422,
+      445,   468,   491,   501,   515,   542,   556,   583,   603,   629,   661,   688,
+      713,   740,   765,   790,   817,   846,   868,   895,   926,   953,   985,  1014,
+     1039,  1064,  1094,  1123,  1145,  1170,  1199,  1230,  1264,  1293,  1322,  1346,
+     1362,  1391,  1407,  1422,  1430,  1437,  1458,  1487,  1508,  1537,  1558,  1585,
+     1615,  1646,  1673,  1700,  1727,  1754,  1780,  1804,  1825,  1855,  1885,  1906,
+     1924,  1951,  1975,  1999,  2021,  2042,  2076,  2094,  2112,  2121,  2139,  2150,
+};
+
+#endif
@@ -42,6 +42,7 @@
 //  Font data for Courier New 12pt
 //
 
+#if FONT_BUILTIN
 const uint8_t Font8_Table[] = {
     // @0 ' ' (5 pixels wide)
     0x00, //
@@ -993,9 +994,14 @@ const uint8_t Font8_Table[] = {
     0x00, //
     0x00, //
 };
+#endif
 
 sFONT Font8 = {
+#if FONT_BUILTIN
     Font8_Table,
+#else
+    NULL,
+#endif
     5, /* Width */
     8, /* Height */
 };
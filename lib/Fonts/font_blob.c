@@ -0,0 +1,220 @@
+/*****************************************************************************
+ * | File      	:   font_blob.c
+ * | Author      :   e-Paper Album
+ * | Function    :   Fonts loaded at run time from a font blob
+ * | Info        :
+ *   A blob made by font_blob.py holds packed sFONT and cFONT glyphs. Attaching
+ *   it points the descriptors of fonts.h with the same name into the blob, in
+ *   place: the blob may sit in memory-mapped flash or in a RAM copy, and must
+ *   stay valid until it is detached.
+ *----------------
+ * |	This version:   V1.0
+ * | Date        :   2026-10-16
+ * | Info        :
+ ******************************************************************************/
+#include "fonts.h"
+#include <string.h>
+
+uint32_t Font_Generation;
+
+/**
+ * Descriptors a blob may replace, and their built-in contents
+ **/
+static struct {
+    const char *Name;
+    sFONT      *Ascii;
+    cFONT      *Cn;
+    sFONT       SavedAscii;
+    cFONT       SavedCn;
+} Font_Slots[] = {
+    {"Font8", &Font8, NULL},
+    {"Font12", &Font12, NULL},
+    {"Font16", &Font16, NULL},
+    {"Font20", &Font20, NULL},
+    {"Font24", &Font24, NULL},
+    {"Font12CN", NULL, &Font12CN},
+    {"Font24CN", NULL, &Font24CN},
+};
+#define FONT_SLOTS (sizeof(Font_Slots) / sizeof(Font_Slots[0]))
+
+static uint8_t Font_Attached;
+
+/**
+ * CRC-32 as zlib.crc32()
+ **/
+static uint32_t Font_Crc32(const uint8_t *Data, uint32_t Len)
+{
+    uint32_t Crc = 0xFFFFFFFF;
+    uint32_t i;
+    int      Bit;
+
+    for (i = 0; i < Len; i++) {
+        Crc ^= Data[i];
+        for (Bit = 0; Bit < 8; Bit++)
+            Crc = (Crc >> 1) ^ (0xEDB88320 & (0 - (Crc & 1)));
+    }
+    return ~Crc;
+}
+
+/**
+ * Packed ASCII font: every box inside the cell, every glyph inside the data
+ **/
+static int Font_CheckAscii(const FONT_BLOB_ENTRY *Entry, const uint8_t *Data)
+{
+    const uint16_t *Offsets = (const uint16_t *)Data;
+    const uint8_t  *Box;
+    uint32_t        Bytes, c;
+
+    if (Entry->size < 96 * sizeof(uint16_t) || Entry->width == 0 || Entry->height == 0)
+        return -1;
+    Bytes = Entry->size - 96 * sizeof(uint16_t);
+    for (c = 0; c < 95; c++) {
+        if (Offsets[c] > Offsets[c + 1] || Offsets[c + 1] > Bytes || Offsets[c + 1] - Offsets[c] < 4)
+            return -1;
+        Box = Data + 96 * sizeof(uint16_t) + Offsets[c];
+        if (Box[0] + Box[2] > Entry->width || Box[1] + Box[3] > Entry->height ||
+            4 + (Box[2] * Box[3] + 7) / 8 > Offsets[c + 1] - Offsets[c])
+            return -1;
+    }
+    return 0;
+}
+
+/**
+ * Packed CN font: index ascending, every box inside the cell and the bitmap
+ **/
+static int Font_CheckCn(const FONT_BLOB_ENTRY *Entry, const uint8_t *Data)
+{
+    const CN_INDEX *Index  = (const CN_INDEX *)Data;
+    const CN_GLYPH *Glyphs = (const CN_GLYPH *)(Index + Entry->glyphs);
+    uint32_t        Head   = Entry->glyphs * (sizeof(CN_INDEX) + sizeof(CN_GLYPH));
+    uint32_t        i;
+
+    if (Entry->size < Head || Entry->ascii_width == 0 || Entry->width == 0 || Entry->height == 0)
+        return -1;
+    for (i = 0; i < Entry->glyphs; i++) {
+        if ((i > 0 && Index[i].code <= Index[i - 1].code) || Index[i].glyph >= Entry->glyphs)
+            return -1;
+        if (Glyphs[i].x + Glyphs[i].w > Entry->width || Glyphs[i].y + Glyphs[i].h > Entry->height ||
+            Glyphs[i].offset > Entry->size - Head ||
+            (uint32_t)Glyphs[i].h * ((Glyphs[i].w + 7) / 8) > Entry->size - Head - Glyphs[i].offset)
+            return -1;
+    }
+    return 0;
+}
+
+/**
+ * Slot of a descriptor name, -1 for names this firmware does not have
+ **/
+static int Font_FindSlot(const FONT_BLOB_ENTRY *Entry)
+{
+    uint32_t i;
+
+    for (i = 0; i < FONT_SLOTS; i++) {
+        if (strncmp(Entry->name, Font_Slots[i].Name, sizeof(Entry->name)) == 0)
+            return (Font_Slots[i].Ascii != NULL) == (Entry->type == FONT_BLOB_ASCII) ? (int)i : -1;
+    }
+    return -1;
+}
+
+/******************************************************************************
+function :  Use the fonts of a blob
+parameter:
+    Blob : Made by font_blob.py, 4-byte aligned; flash or RAM that stays
+           valid until Font_BlobDetach() or the next Font_BlobAttach()
+    Size : Bytes available at Blob
+info:
+    The whole blob is checked first, then every font named in it replaces
+    the descriptor of the same name; unknown names are skipped and the
+    fonts it does not name return to the built-in glyphs.
+    Not thread safe: no drawing may run while the fonts change.
+    Returns the number of fonts replaced, -1 if the blob is invalid.
+******************************************************************************/
+int Font_BlobAttach(const uint8_t *Blob, uint32_t Size)
+{
+    const FONT_BLOB_HEADER *Header = (const FONT_BLOB_HEADER *)Blob;
+    const FONT_BLOB_ENTRY  *Entry;
+    uint32_t                i, Table;
+    int                     Slot, Count = 0;
+
+    // The data is used in place as CN_INDEX / CN_GLYPH arrays
+    if (sizeof(CN_INDEX) != 8 || sizeof(CN_GLYPH) != 8)
+        return -1;
+    if (Blob == NULL || ((uintptr_t)Blob & 3) != 0 || Size < sizeof(FONT_BLOB_HEADER))
+        return -1;
+    if (Header->magic != FONT_BLOB_MAGIC || Header->version != FONT_BLOB_VERSION || Header->size > Size)
+        return -1;
+    Table = sizeof(FONT_BLOB_HEADER) + Header->count * sizeof(FONT_BLOB_ENTRY);
+    if (Header->size < Table)
+        return -1;
+    if (Font_Crc32(Blob + sizeof(FONT_BLOB_HEADER), Header->size - sizeof(FONT_BLOB_HEADER)) != Header->crc)
+        return -1;
+
+    Entry = (const FONT_BLOB_ENTRY *)(Header + 1);
+    for (i = 0; i < Header->count; i++) {
+        if (Entry[i].type > FONT_BLOB_CN || (Entry[i].data & 3) != 0 || Entry[i].data < Table ||
+            Entry[i].data > Header->size || Entry[i].size > Header->size - Entry[i].data)
+            return -1;
+        if (Entry[i].type == FONT_BLOB_ASCII ? Font_CheckAscii(&Entry[i], Blob + Entry[i].data)
+                                             : Font_CheckCn(&Entry[i], Blob + Entry[i].data))
+            return -1;
+    }
+
+    Font_BlobDetach();
+    for (i = 0; i < FONT_SLOTS; i++) {
+        if (Font_Slots[i].Ascii != NULL)
+            Font_Slots[i].SavedAscii = *Font_Slots[i].Ascii;
+        else
+            Font_Slots[i].SavedCn = *Font_Slots[i].Cn;
+    }
+    for (i = 0; i < Header->count; i++) {
+        const uint8_t *Data = Blob + Entry[i].data;
+
+        Slot = Font_FindSlot(&Entry[i]);
+        if (Slot < 0)
+            continue;
+        if (Entry[i].type == FONT_BLOB_ASCII) {
+            sFONT *Font   = Font_Slots[Slot].Ascii;
+            Font->table   = NULL;
+            Font->Width   = Entry[i].width;
+            Font->Height  = Entry[i].height;
+            Font->packed  = Data + 96 * sizeof(uint16_t);
+            Font->offsets = (const uint16_t *)Data;
+        } else {
+            cFONT *Font       = Font_Slots[Slot].Cn;
+            Font->table       = NULL;
+            Font->size        = 0;
+            Font->ASCII_Width = Entry[i].ascii_width;
+            Font->Width       = Entry[i].width;
+            Font->Height      = Entry[i].height;
+            Font->index       = (const CN_INDEX *)Data;
+            Font->index_size  = Entry[i].glyphs;
+            Font->glyphs      = (const CN_GLYPH *)(Font->index + Entry[i].glyphs);
+            Font->bitmap      = (const uint8_t *)(Font->glyphs + Entry[i].glyphs);
+        }
+        Count++;
+    }
+    Font_Attached = 1;
+    Font_Generation++;
+    return Count;
+}
+
+/******************************************************************************
+function :  Return every descriptor to its built-in glyphs
+info:
+    Call before the blob memory is freed or rewritten.
+******************************************************************************/
+void Font_BlobDetach(void)
+{
+    uint32_t i;
+
+    if (!Font_Attached)
+        return;
+    for (i = 0; i < FONT_SLOTS; i++) {
+        if (Font_Slots[i].Ascii != NULL)
+            *Font_Slots[i].Ascii = Font_Slots[i].SavedAscii;
+        else
+            *Font_Slots[i].Cn = Font_Slots[i].SavedCn;
+    }
+    Font_Attached = 0;
+    Font_Generation++;
+}
@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+字体包生成器
+
+把 fontXX.c / fontXXCN.c 打包成一个二进制字体包 (fonts.bin), 可写入 flash 分区或由
+相册服务器通过 get_font 命令下发, 设备上 Font_BlobAttach() 直接在原地使用, 不再复制。
+字模格式与 font_pack.py / cn_index.py 生成的头文件相同。
+
+格式 (小端, 各数据段 4 字节对齐, 与 fonts.h 中的 FONT_BLOB_* 一致):
+    文件头   16 字节: "EPDF", 版本 u16, 字体数 u16, 总长度 u32, 其后全部内容的 CRC-32 u32
+    字体项   32 字节: 名称 char[12], 类型 u8 (0 ASCII / 1 CN), 保留 u8,
+                      宽 u16, 高 u16, ASCII 宽 u16, 字数 u16, 保留 u16, 数据偏移 u32, 数据长度 u32
+    ASCII 数据: 偏移表 u16[96], 压缩字模
+    CN 数据:    CN_INDEX[字数] (码位 u32, 序号 u16, 补齐 2), CN_GLYPH[字数] (位图偏移 u32, x, y, w, h), 位图
+
+使用方法:
+    python3 font_blob.py -o fonts.bin font8.c font12.c font16.c font20.c font24.c font12CN.c font24CN.c
+    python3 font_blob.py --list fonts.bin
+"""
+
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+import cn_index
+import font_pack
+
+MAGIC = b'EPDF'
+VERSION = 1
+HEADER = struct.Struct('<4sHHII')
+ENTRY = struct.Struct('<12sBBHHHHHII')
+TYPE_ASCII, TYPE_CN = 0, 1
+
+
+def align(data):
+    return data + b'\0' * (-len(data) % 4)
+
+
+def ascii_font(path):
+    name, width, height, packed, offsets, _ = font_pack.load(path)
+    data = struct.pack('<%dH' % len(offsets), *offsets) + bytes(packed)
+    return name, TYPE_ASCII, width, height, 0, 0, data
+
+
+def cn_font(path):
+    name, ascii_width, width, height, entries, bitmap = cn_index.load(path)
+    index = b''.join(struct.pack('<IH2x', c, n) for n, (c, _, _, _, _, _, _) in enumerate(entries))
+    glyphs = b''.join(struct.pack('<I4B', o, x, y, w, h) for _, _, x, y, w, h, o in entries)
+    return name, TYPE_CN, width, height, ascii_width, len(entries), index + glyphs + bytes(bitmap)
+
+
+def build(paths):
+    fonts = [cn_font(p) if os.path.basename(p).lower().endswith('cn.c') else ascii_font(p) for p in paths]
+    offset = HEADER.size + ENTRY.size * len(fonts)
+    entries, body = b'', b''
+    for name, kind, width, height, ascii_width, count, data in fonts:
+        if len(name) > 11:
+            raise SystemExit('%s: name longer than 11 characters' % name)
+        entries += ENTRY.pack(name.encode('ascii'), kind, 0, width, height, ascii_width, count, 0,
+                              offset + len(body), len(data))
+        body += align(data)
+    rest = entries + body
+    return HEADER.pack(MAGIC, VERSION, len(fonts), HEADER.size + len(rest), zlib.crc32(rest) & 0xFFFFFFFF) + rest
+
+
+def show(path):
+    with open(path, 'rb') as f:
+        blob = f.read()
+    magic, version, count, size, crc = HEADER.unpack_from(blob)
+    ok = magic == MAGIC and size == len(blob) and zlib.crc32(blob[HEADER.size:]) & 0xFFFFFFFF == crc
+    print('%s: version %d, %d fonts, %d bytes, %s' % (path, version, count, size, 'ok' if ok else 'CORRUPT'))
+    for i in range(count):
+        name, kind, _, width, height, ascii_width, n, _, offset, length = ENTRY.unpack_from(
+            blob, HEADER.size + i * ENTRY.size)
+        name = name.rstrip(b'\0').decode('ascii')
+        if kind == TYPE_CN:
+            print('  %-10s CN    %2d x %2d, ASCII %2d, %3d glyphs, %5d bytes' % (name, width, height, ascii_width,
+                                                                            n, length))
+        else:
+            print('  %-10s ASCII %2d x %2d, %5d bytes' % (name, width, height, length))
+    return 0 if ok else 1
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description='Pack sFONT/cFONT sources into a font blob')
+    parser.add_argument('-o', '--output', default='fonts.bin', help='blob to write (default: fonts.bin)')
+    parser.add_argument('--list', action='store_true', help='print the fonts of existing blobs')
+    parser.add_argument('files', nargs='+')
+    args = parser.parse_args(argv)
+
+    if args.list:
+        return max(show(p) for p in args.files)
+    blob = build(args.files)
+    with open(args.output, 'wb') as f:
+        f.write(blob)
+    print('wrote %s (%d bytes)' % (args.output, len(blob)))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
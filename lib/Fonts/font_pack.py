@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+ASCII 字体压缩生成器
+
+读取 fontXX.c 中的 sFONT 点阵表 (95 个字符, ' ' 到 '~'), 生成 fontXX_packed.h:
+- XXX_Packed:  每个字符先存墨迹包围盒 x, y, w, h 四个字节, 再按行连续存放
+               盒内的 w * h 个点 (高位在前, 行间不补齐)
+- XXX_Offsets: 96 项, 每个字符在 XXX_Packed 中的起点, 最后一项为总长度
+Paint_DrawChar() 按需把一个字符解回原表格式, 每个绘图上下文缓存最近用过的几个。
+
+使用方法:
+    python3 font_pack.py font12.c font16.c font20.c font24.c
+    python3 font_pack.py --check font*.c    # 生成结果过期时返回 1
+
+CMake 配置时会自动运行, 修改点阵表后无需手动执行。
+"""
+
+import os
+import re
+import sys
+
+CHARS = 95  # ' ' .. '~'
+TABLE_RE = re.compile(r'const\s+uint8_t\s+(\w+)_Table\s*\[\]\s*=\s*\{(.*?)\};', re.S)
+SIZE_RE = re.compile(r'(\d+)\s*,\s*/\*\s*(Width|Height)\s*\*/')
+
+HEADER = """\
+/* Generated by font_pack.py from {src}, do not edit */
+#ifndef __{guard}_PACKED_H
+#define __{guard}_PACKED_H
+
+#include "fonts.h"
+
+/* {width} x {height}, {packed} bytes instead of {raw} */
+static const uint8_t {name}_Packed[] = {{
+{rows}
+}};
+
+static const uint16_t {name}_Offsets[{count}] = {{
+{offsets}
+}};
+
+#endif
+"""
+
+
+def pack(glyph, width, height):
+    """墨迹包围盒加盒内连续点阵"""
+    stride = (width + 7) // 8
+    ink = [(i, j) for j in range(height) for i in range(width)
+           if glyph[j * stride + i // 8] & (0x80 >> (i % 8))]
+    if not ink:
+        return [0, 0, 0, 0]
+    x0, x1 = min(i for i, _ in ink), max(i for i, _ in ink)
+    y0, y1 = min(j for _, j in ink), max(j for _, j in ink)
+    w, h = x1 - x0 + 1, y1 - y0 + 1
+    bits = [0] * ((w * h + 7) // 8)
+    for i, j in ink:
+        n = (j - y0) * w + (i - x0)
+        bits[n // 8] |= 0x80 >> (n % 8)
+    return [x0, y0, w, h] + bits
+
+
+def load(path):
+    """返回 (名称, 宽, 高, 压缩字模, 偏移表, 原表字节数)"""
+    with open(path, encoding='utf-8') as f:
+        src = re.sub(r'//[^\n]*', '', f.read())
+    m = TABLE_RE.search(src)
+    if m is None:
+        raise SystemExit('%s: no sFONT table' % path)
+    name = m.group(1)
+    table = [int(b, 16) for b in re.findall(r'0x[0-9A-Fa-f]+', m.group(2))]
+    size = dict((k, int(v)) for v, k in SIZE_RE.findall(src[m.end():]))
+    width, height = size['Width'], size['Height']
+    per = (width + 7) // 8 * height
+    if len(table) != per * CHARS:
+        raise SystemExit('%s: %d bytes, expected %d' % (path, len(table), per * CHARS))
+    if width > 24 or height > 24:
+        raise SystemExit('%s: %d x %d is larger than PAINT_GLYPH_MAX_W/H' % (path, width, height))
+
+    packed, offsets = [], []
+    for c in range(CHARS):
+        offsets.append(len(packed))
+        packed.extend(pack(table[c * per:(c + 1) * per], width, height))
+    offsets.append(len(packed))
+    if len(packed) > 0xFFFF:
+        raise SystemExit('%s: %d bytes do not fit the 16-bit offsets' % (path, len(packed)))
+    return name, width, height, packed, offsets, len(table)
+
+
+def build(path):
+    name, width, height, packed, offsets, raw = load(path)
+    rows = []
+    for c in range(CHARS):
+        glyph = packed[offsets[c]:offsets[c + 1]]
+        rows.append('    ' + ' '.join('0x%02X,' % b for b in glyph) + " // '%s'" % chr(32 + c))
+
+    lines = ['    ' + ' '.join('%5d,' % o for o in offsets[i:i + 12]) for i in range(0, len(offsets), 12)]
+    out = os.path.join(os.path.dirname(path), os.path.basename(path)[:-2] + '_packed.h')
+    return out, HEADER.format(src=os.path.basename(path), guard=name.upper(), name=name, width=width,
+                              height=height, packed=len(packed) + 2 * len(offsets), raw=raw,
+                              rows='\n'.join(rows), count=len(offsets), offsets='\n'.join(lines))
+
+
+def main(argv):
+    check = '--check' in argv
+    stale = 0
+    for path in [a for a in argv if a != '--check']:
+        out, text = build(path)
+        old = None
+        if os.path.exists(out):
+            with open(out, encoding='utf-8') as f:
+                old = f.read()
+        if old == text:
+            continue
+        stale = 1
+        if check:
+            print('%s is out of date' % out)
+        else:
+            with open(out, 'w', encoding='utf-8') as f:
+                f.write(text)
+            print('wrote %s' % out)
+    return stale if check else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
@@ -49,13 +49,16 @@ extern "C" {
 #endif
 
 /* Includes ------------------------------------------------------------------*/
+#include <stddef.h>
 #include <stdint.h>
 // #include <avr/pgmspace.h>
 // ASCII
 typedef struct _tFont {
-    const uint8_t *table;
-    uint16_t       Width;
-    uint16_t       Height;
+    const uint8_t  *table;   // NULL for packed fonts
+    uint16_t        Width;
+    uint16_t        Height;
+    const uint8_t  *packed;  // Ink box x, y, w, h and its bits per character, see font_pack.py
+    const uint16_t *offsets; // Start of ' ' .. '~' in packed, NULL: table
 
 } sFONT;
 
@@ -66,15 +69,49 @@ typedef struct // Chinese character mold data structure
     const char    matrix[MAX_HEIGHT_FONT * MAX_WIDTH_FONT / 8]; // Dot matrix code data
 } CH_CN;
 
+// Code point to table entry, generated by cn_index.py
 typedef struct {
-    const CH_CN *table;
-    uint16_t     size;
-    uint16_t     ASCII_Width;
-    uint16_t     Width;
-    uint16_t     Height;
+    uint32_t code;  // Unicode code point
+    uint16_t glyph; // Entry of the CH_CN table
+} CN_INDEX;
+
+// Packed glyph: the ink box inside the Width x Height cell, rows of (w + 7) / 8 bytes
+typedef struct {
+    uint32_t offset; // First byte in cFONT.bitmap
+    uint8_t  x;      // Top left of the box in the cell
+    uint8_t  y;
+    uint8_t  w;      // 0 x 0 for a blank glyph
+    uint8_t  h;
+} CN_GLYPH;
+
+typedef struct {
+    const CH_CN    *table; // NULL for packed fonts
+    uint16_t        size;
+    uint16_t        ASCII_Width;
+    uint16_t        Width;
+    uint16_t        Height;
+    const CN_INDEX *index; // Sorted by code, NULL: linear scan of table
+    uint16_t        index_size;
+    const CN_GLYPH *glyphs; // Packed glyph of each index entry, NULL: table matrices
+    const uint8_t  *bitmap;
 
 } cFONT;
 
+// 0: no glyphs are linked, the descriptors below stay empty until Font_BlobAttach()
+#ifndef FONT_BUILTIN
+#define FONT_BUILTIN 1
+#endif
+
+// 1: Font12/16/20/24 link only the packed glyphs of fontXX_packed.h, decoded per character on demand
+#ifndef FONT_ASCII_PACKED
+#define FONT_ASCII_PACKED 1
+#endif
+
+// 1: Font12CN/Font24CN link only the packed glyphs of fontXXCN_index.h, 0: the CH_CN tables
+#ifndef FONT_CN_PACKED
+#define FONT_CN_PACKED 1
+#endif
+
 extern sFONT Font24;
 extern sFONT Font20;
 extern sFONT Font16;
@@ -85,6 +122,41 @@ extern cFONT Font12CN;
 extern cFONT Font24CN;
 // extern const unsigned char Font16_Table[];
 
+// Font blob made by font_blob.py: FONT_BLOB_HEADER, count FONT_BLOB_ENTRY, then the data of each font.
+// Little endian, data 4-byte aligned; ASCII fonts hold offsets[96] and the packed glyphs,
+// CN fonts CN_INDEX[glyphs], CN_GLYPH[glyphs] and the bitmap.
+#define FONT_BLOB_MAGIC   0x46445045 // "EPDF"
+#define FONT_BLOB_VERSION 1
+#define FONT_BLOB_ASCII   0
+#define FONT_BLOB_CN      1
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count; // Fonts in the blob
+    uint32_t size;  // Bytes of the whole blob
+    uint32_t crc;   // CRC-32 of the bytes after the header
+} FONT_BLOB_HEADER;
+
+typedef struct {
+    char     name[12];    // Descriptor it replaces: "Font24", "Font24CN", ...
+    uint8_t  type;        // FONT_BLOB_ASCII or FONT_BLOB_CN
+    uint8_t  reserved;
+    uint16_t width;
+    uint16_t height;
+    uint16_t ascii_width; // CN only
+    uint16_t glyphs;      // CN only: entries of the index
+    uint16_t reserved2;
+    uint32_t data;        // Offset of the font data from the start of the blob
+    uint32_t size;
+} FONT_BLOB_ENTRY;
+
+// Bumped whenever a blob changes the descriptors; glyph caches keyed on a descriptor compare it
+extern uint32_t Font_Generation;
+
+int  Font_BlobAttach(const uint8_t *Blob, uint32_t Size);
+void Font_BlobDetach(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -55,7 +55,7 @@
 #include <math.h>   //memset()
 #include <stdio.h>
 
-UBYTE GUI_ReadBmp(const char *path, UWORD Xstart, UWORD Ystart)
+UBYTE GUI_Ctx_ReadBmp(PAINT *Ctx, const char *path, UWORD Xstart, UWORD Ystart)
 {
     FILE         *fp;            // Define a file pointer
     BMPFILEHEADER bmpFileHeader; // Define a bmp file header structure
@@ -127,12 +127,12 @@ UBYTE GUI_ReadBmp(const char *path, UWORD Xstart, UWORD Ystart)
     UBYTE color, temp;
     for (y = 0; y < bmpInfoHeader.biHeight; y++) {
         for (x = 0; x < bmpInfoHeader.biWidth; x++) {
-            if (x > Paint.Width || y > Paint.Height) {
+            if (x > Ctx->Width || y > Ctx->Height) {
                 break;
             }
             temp  = Image[(x / 8) + (y * Image_Width_Byte)];
             color = (((temp << (x % 8)) & 0x80) == 0x80) ? Bcolor : Wcolor;
-            Paint_SetPixel(Xstart + x, Ystart + y, color);
+            Paint_Ctx_SetPixel(Ctx, Xstart + x, Ystart + y, color);
         }
     }
     return 0;
@@ -140,7 +140,7 @@ UBYTE GUI_ReadBmp(const char *path, UWORD Xstart, UWORD Ystart)
 /*************************************************************************
 
 *************************************************************************/
-UBYTE GUI_ReadBmp_4Gray(const char *path, UWORD Xstart, UWORD Ystart)
+UBYTE GUI_Ctx_ReadBmp_4Gray(PAINT *Ctx, const char *path, UWORD Xstart, UWORD Ystart)
 {
     FILE         *fp;            // Define a file pointer
     BMPFILEHEADER bmpFileHeader; // Define a bmp file header structure
@@ -196,18 +196,18 @@ UBYTE GUI_ReadBmp_4Gray(const char *path, UWORD Xstart, UWORD Ystart)
     printf("bmpInfoHeader.biHeight = %d\r\n", bmpInfoHeader.biHeight);
     for (y = 0; y < bmpInfoHeader.biHeight; y++) {
         for (x = 0; x < bmpInfoHeader.biWidth; x++) {
-            if (x > Paint.Width || y > Paint.Height) {
+            if (x > Ctx->Width || y > Ctx->Height) {
                 break;
             }
             temp  = Image[x / 2 + y * bmpInfoHeader.biWidth / 2] >> ((x % 2) ? 0 : 4); // 0xf 0x8 0x7 0x0
             color = temp >> 2;                                                         // 11  10  01  00
-            Paint_SetPixel(Xstart + x, Ystart + y, color);
+            Paint_Ctx_SetPixel(Ctx, Xstart + x, Ystart + y, color);
         }
     }
     return 0;
 }
 
-UBYTE GUI_ReadBmp_16Gray(const char *path, UWORD Xstart, UWORD Ystart)
+UBYTE GUI_Ctx_ReadBmp_16Gray(PAINT *Ctx, const char *path, UWORD Xstart, UWORD Ystart)
 {
     FILE         *fp;            // Define a file pointer
     BMPFILEHEADER bmpFileHeader; // Define a bmp file header structure
@@ -278,17 +278,17 @@ UBYTE GUI_ReadBmp_16Gray(const char *path, UWORD Xstart, UWORD Ystart)
     printf("bmpInfoHeader.biHeight = %d\r\n", bmpInfoHeader.biHeight);
     for (y = 0; y < bmpInfoHeader.biHeight; y++) {
         for (x = 0; x < bmpInfoHeader.biWidth; x++) {
-            if (Xstart + x > Paint.Width || Ystart + y > Paint.Height)
+            if (Xstart + x > Ctx->Width || Ystart + y > Ctx->Height)
                 break;
 
             coloridx = (Image[x / 2 + y * Width_Byte] >> ((x % 2) ? 0 : 4)) & 15;
-            Paint_SetPixel(Xstart + x, Ystart + y, colors[coloridx]);
+            Paint_Ctx_SetPixel(Ctx, Xstart + x, Ystart + y, colors[coloridx]);
         }
     }
     return 0;
 }
 
-UBYTE GUI_ReadBmp_RGB_7Color(const char *path, UWORD Xstart, UWORD Ystart)
+UBYTE GUI_Ctx_ReadBmp_RGB_7Color(PAINT *Ctx, const char *path, UWORD Xstart, UWORD Ystart)
 {
     FILE         *fp;            // Define a file pointer
     BMPFILEHEADER bmpFileHeader; // Define a bmp file header structure
@@ -358,18 +358,18 @@ UBYTE GUI_ReadBmp_RGB_7Color(const char *path, UWORD Xstart, UWORD Ystart)
     // Refresh the image to the display buffer based on the displayed orientation
     for (y = 0; y < bmpInfoHeader.biHeight; y++) {
         for (x = 0; x < bmpInfoHeader.biWidth; x++) {
-            if (x > Paint.Width || y > Paint.Height) {
+            if (x > Ctx->Width || y > Ctx->Height) {
                 break;
             }
-            Paint_SetPixel(Xstart + x, Ystart + y,
-                           Image[bmpInfoHeader.biHeight * bmpInfoHeader.biWidth - 1 -
-                                 (bmpInfoHeader.biWidth - x - 1 + (y * bmpInfoHeader.biWidth))]);
+            Paint_Ctx_SetPixel(Ctx, Xstart + x, Ystart + y,
+                               Image[bmpInfoHeader.biHeight * bmpInfoHeader.biWidth - 1 -
+                                     (bmpInfoHeader.biWidth - x - 1 + (y * bmpInfoHeader.biWidth))]);
         }
     }
     return 0;
 }
 
-UBYTE GUI_ReadBmp_RGB_4Color(const char *path, UWORD Xstart, UWORD Ystart)
+UBYTE GUI_Ctx_ReadBmp_RGB_4Color(PAINT *Ctx, const char *path, UWORD Xstart, UWORD Ystart)
 {
     FILE         *fp;            // Define a file pointer
     BMPFILEHEADER bmpFileHeader; // Define a bmp file header structure
@@ -440,18 +440,18 @@ UBYTE GUI_ReadBmp_RGB_4Color(const char *path, UWORD Xstart, UWORD Ystart)
     // Refresh the image to the display buffer based on the displayed orientation
     for (y = 0; y < bmpInfoHeader.biHeight; y++) {
         for (x = 0; x < bmpInfoHeader.biWidth; x++) {
-            if (x > Paint.Width || y > Paint.Height) {
+            if (x > Ctx->Width || y > Ctx->Height) {
                 break;
             }
-            Paint_SetPixel(Xstart + x, Ystart + y,
-                           Image[bmpInfoHeader.biHeight * bmpInfoHeader.biWidth - 1 -
-                                 (bmpInfoHeader.biWidth - x - 1 + (y * bmpInfoHeader.biWidth))]);
+            Paint_Ctx_SetPixel(Ctx, Xstart + x, Ystart + y,
+                               Image[bmpInfoHeader.biHeight * bmpInfoHeader.biWidth - 1 -
+                                     (bmpInfoHeader.biWidth - x - 1 + (y * bmpInfoHeader.biWidth))]);
         }
     }
     return 0;
 }
 
-UBYTE GUI_ReadBmp_RGB_6Color(const char *path, UWORD Xstart, UWORD Ystart)
+UBYTE GUI_Ctx_ReadBmp_RGB_6Color(PAINT *Ctx, const char *path, UWORD Xstart, UWORD Ystart)
 {
     FILE         *fp;            // Define a file pointer
     BMPFILEHEADER bmpFileHeader; // Define a bmp file header structure
@@ -521,13 +521,46 @@ UBYTE GUI_ReadBmp_RGB_6Color(const char *path, UWORD Xstart, UWORD Ystart)
     // Refresh the image to the display buffer based on the displayed orientation
     for (y = 0; y < bmpInfoHeader.biHeight; y++) {
         for (x = 0; x < bmpInfoHeader.biWidth; x++) {
-            if (x > Paint.Width || y > Paint.Height) {
+            if (x > Ctx->Width || y > Ctx->Height) {
                 break;
             }
-            Paint_SetPixel(Xstart + x, Ystart + y,
-                           Image[bmpInfoHeader.biHeight * bmpInfoHeader.biWidth - 1 -
-                                 (bmpInfoHeader.biWidth - x - 1 + (y * bmpInfoHeader.biWidth))]);
+            Paint_Ctx_SetPixel(Ctx, Xstart + x, Ystart + y,
+                               Image[bmpInfoHeader.biHeight * bmpInfoHeader.biWidth - 1 -
+                                     (bmpInfoHeader.biWidth - x - 1 + (y * bmpInfoHeader.biWidth))]);
         }
     }
     return 0;
 }
+
+/*************************************************************************
+ * Default-context API on Paint, kept for existing callers
+*************************************************************************/
+UBYTE GUI_ReadBmp(const char *path, UWORD Xstart, UWORD Ystart)
+{
+    return GUI_Ctx_ReadBmp(&Paint, path, Xstart, Ystart);
+}
+
+UBYTE GUI_ReadBmp_4Gray(const char *path, UWORD Xstart, UWORD Ystart)
+{
+    return GUI_Ctx_ReadBmp_4Gray(&Paint, path, Xstart, Ystart);
+}
+
+UBYTE GUI_ReadBmp_16Gray(const char *path, UWORD Xstart, UWORD Ystart)
+{
+    return GUI_Ctx_ReadBmp_16Gray(&Paint, path, Xstart, Ystart);
+}
+
+UBYTE GUI_ReadBmp_RGB_7Color(const char *path, UWORD Xstart, UWORD Ystart)
+{
+    return GUI_Ctx_ReadBmp_RGB_7Color(&Paint, path, Xstart, Ystart);
+}
+
+UBYTE GUI_ReadBmp_RGB_4Color(const char *path, UWORD Xstart, UWORD Ystart)
+{
+    return GUI_Ctx_ReadBmp_RGB_4Color(&Paint, path, Xstart, Ystart);
+}
+
+UBYTE GUI_ReadBmp_RGB_6Color(const char *path, UWORD Xstart, UWORD Ystart)
+{
+    return GUI_Ctx_ReadBmp_RGB_6Color(&Paint, path, Xstart, Ystart);
+}
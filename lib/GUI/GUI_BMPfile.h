@@ -51,6 +51,7 @@
 #include <stdint.h>
 
 #include "DEV_Config.h"
+#include "GUI_Paint.h"
 
 /*Bitmap file header   14bit*/
 typedef struct BMP_FILE_HEADER {
@@ -91,4 +92,12 @@ UBYTE GUI_ReadBmp_16Gray(const char *path, UWORD Xstart, UWORD Ystart);
 UBYTE GUI_ReadBmp_RGB_4Color(const char *path, UWORD Xstart, UWORD Ystart);
 UBYTE GUI_ReadBmp_RGB_6Color(const char *path, UWORD Xstart, UWORD Ystart);
 UBYTE GUI_ReadBmp_RGB_7Color(const char *path, UWORD Xstart, UWORD Ystart);
+
+// Same on an explicit context; the calls above draw on Paint
+UBYTE GUI_Ctx_ReadBmp(PAINT *Ctx, const char *path, UWORD Xstart, UWORD Ystart);
+UBYTE GUI_Ctx_ReadBmp_4Gray(PAINT *Ctx, const char *path, UWORD Xstart, UWORD Ystart);
+UBYTE GUI_Ctx_ReadBmp_16Gray(PAINT *Ctx, const char *path, UWORD Xstart, UWORD Ystart);
+UBYTE GUI_Ctx_ReadBmp_RGB_4Color(PAINT *Ctx, const char *path, UWORD Xstart, UWORD Ystart);
+UBYTE GUI_Ctx_ReadBmp_RGB_6Color(PAINT *Ctx, const char *path, UWORD Xstart, UWORD Ystart);
+UBYTE GUI_Ctx_ReadBmp_RGB_7Color(PAINT *Ctx, const char *path, UWORD Xstart, UWORD Ystart);
 #endif
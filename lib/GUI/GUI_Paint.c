@@ -12,6 +12,30 @@
  * | Date        :   2020-07-23
  * | Info        :
  * -----------------------------------------------------------------------------
+ * V3.3(2026-10-16):
+ * 1. Add: PAINT.SetPixel
+ *			A pixel writer per rotate/mirror/scale, bound when they change
+ * 2. Add: Paint_SetPixelFast() for primitives that clip once
+ * 3. Change: Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
+ *			Range check, then the bound writer; X == Width is rejected
+ * 4. Change: Paint_Clear(), Paint_ClearWindows(), filled rectangles and
+ *			circles, solid horizontal and vertical lines fill byte spans
+ * 5. Add: Paint_Ctx_*(PAINT *Ctx, ...)
+ *			Every function on an explicit context; Paint_*() draw on Paint
+ * 6. Add: Paint_Ctx_SetGlyphCache()
+ *			LRU cache of 4bpp glyphs for Paint_DrawChar(), on by default for Paint
+ * 7. Change: Paint_DrawString_CN()
+ *			Decodes UTF-8 and finds glyphs by binary search of cFONT.index
+ * 8. Add: packed CN fonts (cFONT.glyphs/bitmap), drawn from the ink box
+ * 9. Add: packed ASCII fonts (sFONT.packed/offsets), decoded per character
+ *			into the LRU slots of the context
+ * 10. Change: glyph caches are emptied when Font_Generation moves, i.e. after
+ *			Font_BlobAttach() or Font_BlobDetach()
+ * 11. Add: Paint_Ctx_GetDirty(), Paint_Ctx_GetDirtyRows(), Paint_Ctx_ResetDirty(),
+ *			Paint_Ctx_MarkDirty()
+ *			Primitives record the memory rectangles they change, merged
+ *			into at most PAINT_DIRTY_RECTS
+ *
  * V3.2(2020-07-23):
  * 1. Change: Paint_SetScale(UBYTE scale)
  *			Add scale 7 for 5.65f e-Parper
@@ -84,6 +108,680 @@
 #include <math.h>
 
 PAINT Paint;
+static PAINT_GLYPH_CACHE Paint_Glyphs; // Glyph cache of Paint
+
+/**
+ * Pixel writers in memory coordinates, one per bit depth
+ **/
+static inline void Paint_Put1(PAINT *Ctx, UWORD X, UWORD Y, UWORD Color)
+{
+    UDOUBLE Addr  = X / 8 + Y * Ctx->WidthByte;
+    UBYTE   Rdata = Ctx->Image[Addr];
+    if (Color == BLACK)
+        Ctx->Image[Addr] = Rdata & ~(0x80 >> (X % 8));
+    else
+        Ctx->Image[Addr] = Rdata | (0x80 >> (X % 8));
+}
+
+static inline void Paint_Put2(PAINT *Ctx, UWORD X, UWORD Y, UWORD Color)
+{
+    UDOUBLE Addr = X / 4 + Y * Ctx->WidthByte;
+    Color        = Color % 4; // Guaranteed color scale is 4  --- 0~3
+    UBYTE Rdata  = Ctx->Image[Addr];
+
+    Rdata            = Rdata & (~(0xC0 >> ((X % 4) * 2)));
+    Ctx->Image[Addr] = Rdata | ((Color << 6) >> ((X % 4) * 2));
+}
+
+static inline void Paint_Put4(PAINT *Ctx, UWORD X, UWORD Y, UWORD Color)
+{
+    UDOUBLE Addr     = X / 2 + Y * Ctx->WidthByte;
+    UBYTE   Rdata    = Ctx->Image[Addr];
+    Rdata            = Rdata & (~(0xF0 >> ((X % 2) * 4))); // Clear first, then set value
+    Ctx->Image[Addr] = Rdata | ((Color << 4) >> ((X % 2) * 4));
+}
+
+/**
+ * One writer per mapping of logical to memory coordinates:
+ * Swap exchanges the axes (90, 270), FlipX/FlipY count from the far
+ * edge (rotation and mirroring combined). Constants fold at compile time.
+ **/
+#define PAINT_KERNEL(Bits, Swap, FlipX, FlipY)                                                            \
+    static void Paint_Kernel##Bits##_##Swap##FlipX##FlipY(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, UWORD Color) \
+    {                                                                                                     \
+        UWORD X = (Swap) ? Ypoint : Xpoint;                                                               \
+        UWORD Y = (Swap) ? Xpoint : Ypoint;                                                               \
+        if (FlipX)                                                                                        \
+            X = Ctx->WidthMemory - X - 1;                                                                 \
+        if (FlipY)                                                                                        \
+            Y = Ctx->HeightMemory - Y - 1;                                                                \
+        Paint_Put##Bits(Ctx, X, Y, Color);                                                                \
+    }
+
+#define PAINT_KERNELS(Bits)        \
+    PAINT_KERNEL(Bits, 0, 0, 0)    \
+    PAINT_KERNEL(Bits, 0, 0, 1)    \
+    PAINT_KERNEL(Bits, 0, 1, 0)    \
+    PAINT_KERNEL(Bits, 0, 1, 1)    \
+    PAINT_KERNEL(Bits, 1, 0, 0)    \
+    PAINT_KERNEL(Bits, 1, 0, 1)    \
+    PAINT_KERNEL(Bits, 1, 1, 0)    \
+    PAINT_KERNEL(Bits, 1, 1, 1)
+
+#define PAINT_KERNEL_ROW(Bits)                                                              \
+    {                                                                                       \
+        Paint_Kernel##Bits##_000, Paint_Kernel##Bits##_001, Paint_Kernel##Bits##_010,       \
+        Paint_Kernel##Bits##_011, Paint_Kernel##Bits##_100, Paint_Kernel##Bits##_101,       \
+        Paint_Kernel##Bits##_110, Paint_Kernel##Bits##_111,                                 \
+    }
+
+PAINT_KERNELS(1)
+PAINT_KERNELS(2)
+PAINT_KERNELS(4)
+
+// [bit depth][Swap << 2 | FlipX << 1 | FlipY]
+static const PAINT_PIXEL_FN Paint_Kernels[3][8] = {
+    PAINT_KERNEL_ROW(1),
+    PAINT_KERNEL_ROW(2),
+    PAINT_KERNEL_ROW(4),
+};
+
+#define PAINT_MAP_SWAP  0x04
+#define PAINT_MAP_FLIPX 0x02
+#define PAINT_MAP_FLIPY 0x01
+
+/**
+ * Writer for a rotate or scale that draws nothing
+ **/
+static void Paint_KernelNone(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, UWORD Color)
+{
+    (void)Ctx;
+    (void)Xpoint;
+    (void)Ypoint;
+    (void)Color;
+}
+
+/******************************************************************************
+function: Pick the pixel writer for the current rotate, mirror and scale
+parameter:
+info:
+    WidthClip/HeightClip keep the writer inside the buffer also when the
+    rotation was changed after Paint_NewImage() without new Width/Height.
+******************************************************************************/
+static void Paint_Bind(PAINT *Ctx)
+{
+    UBYTE Map;
+    int   Depth;
+
+    memset(&Ctx->DirtyHint, 0, sizeof(Ctx->DirtyHint)); // Mapped differently from now on
+
+    switch (Ctx->Rotate) {
+    case ROTATE_0:
+        Map = 0;
+        break;
+    case ROTATE_90:
+        Map = PAINT_MAP_SWAP | PAINT_MAP_FLIPX;
+        break;
+    case ROTATE_180:
+        Map = PAINT_MAP_FLIPX | PAINT_MAP_FLIPY;
+        break;
+    case ROTATE_270:
+        Map = PAINT_MAP_SWAP | PAINT_MAP_FLIPY;
+        break;
+    default:
+        Ctx->SetPixel = Paint_KernelNone;
+        Ctx->Bits     = 0;
+        return;
+    }
+    if (Ctx->Mirror & MIRROR_HORIZONTAL)
+        Map ^= PAINT_MAP_FLIPX;
+    if (Ctx->Mirror & MIRROR_VERTICAL)
+        Map ^= PAINT_MAP_FLIPY;
+
+    if (Ctx->Scale == 2)
+        Depth = 0;
+    else if (Ctx->Scale == 4)
+        Depth = 1;
+    else if (Ctx->Scale == 7 || Ctx->Scale == 16)
+        Depth = 2;
+    else
+        Depth = -1;
+    Ctx->SetPixel = (Depth < 0) ? Paint_KernelNone : Paint_Kernels[Depth][Map];
+    Ctx->Bits     = (Depth < 0) ? 0 : 1 << Depth;
+    Ctx->Map      = Map;
+
+    if (Map & PAINT_MAP_SWAP) {
+        Ctx->WidthClip  = (Ctx->Width < Ctx->HeightMemory) ? Ctx->Width : Ctx->HeightMemory;
+        Ctx->HeightClip = (Ctx->Height < Ctx->WidthMemory) ? Ctx->Height : Ctx->WidthMemory;
+    } else {
+        Ctx->WidthClip  = (Ctx->Width < Ctx->WidthMemory) ? Ctx->Width : Ctx->WidthMemory;
+        Ctx->HeightClip = (Ctx->Height < Ctx->HeightMemory) ? Ctx->Height : Ctx->HeightMemory;
+    }
+}
+
+/**
+ * Range-checked writer with the PAINT_PIXEL_FN signature
+ **/
+static void Paint_PutChecked(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, UWORD Color)
+{
+    if (Xpoint >= Ctx->WidthClip || Ypoint >= Ctx->HeightClip) {
+        Debug("Exceeding display boundaries\r\n");
+        return;
+    }
+    Ctx->SetPixel(Ctx, Xpoint, Ypoint, Color);
+}
+
+/**
+ * Writer for a W x H block at (Xpoint, Ypoint): unchecked when it fits
+ **/
+static PAINT_PIXEL_FN Paint_BlockWriter(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, UWORD W, UWORD H)
+{
+    if ((UDOUBLE)Xpoint + W <= Ctx->WidthClip && (UDOUBLE)Ypoint + H <= Ctx->HeightClip)
+        return Ctx->SetPixel;
+    return Paint_PutChecked;
+}
+
+/**
+ * Color repeated over a whole byte, as the bound writer would store it
+ **/
+static UBYTE Paint_FillByte(PAINT *Ctx, UWORD Color)
+{
+    if (Ctx->Bits == 1)
+        return (Color == BLACK) ? 0x00 : 0xFF;
+    if (Ctx->Bits == 2)
+        return (Color % 4) * 0x55;
+    return (Color & 0x0F) * 0x11;
+}
+
+/******************************************************************************
+function: Fill the pixels [X0, X1) of a memory row
+parameter:
+    Ctx  : Image with Bits 1, 2 or 4
+    Y    : Memory row
+    X0   : First memory column
+    X1   : End column, exclusive, above X0
+    Fill : Paint_FillByte() of the color
+info:
+    Partial bytes at either end are merged under a mask, the bytes between
+    are set with memset().
+******************************************************************************/
+static void Paint_FillSpan(PAINT *Ctx, UWORD Y, UWORD X0, UWORD X1, UBYTE Fill)
+{
+    UBYTE  *Row  = Ctx->Image + (UDOUBLE)Y * Ctx->WidthByte;
+    UDOUBLE B0   = (UDOUBLE)X0 * Ctx->Bits;
+    UDOUBLE B1   = (UDOUBLE)X1 * Ctx->Bits;
+    UDOUBLE I0   = B0 / 8;
+    UDOUBLE I1   = B1 / 8;
+    UBYTE   Head = 0xFF >> (B0 % 8);
+    UBYTE   Tail = (UBYTE)(0xFF << (8 - B1 % 8));
+
+    if (I0 == I1) { // Inside one byte
+        Head &= Tail;
+        Row[I0] = (Row[I0] & ~Head) | (Fill & Head);
+        return;
+    }
+    if (B0 % 8) {
+        Row[I0] = (Row[I0] & ~Head) | (Fill & Head);
+        I0++;
+    }
+    memset(Row + I0, Fill, I1 - I0);
+    if (B1 % 8)
+        Row[I1] = (Row[I1] & ~Tail) | (Fill & Tail);
+}
+
+/**
+ * Logical box [X0, X1) x [Y0, Y1) inside the clip area to the memory box it
+ * covers, in place
+ **/
+static void Paint_MapBox(PAINT *Ctx, int *X0, int *Y0, int *X1, int *Y1)
+{
+    int T;
+
+    if (Ctx->Map & PAINT_MAP_SWAP) {
+        T   = *X0;
+        *X0 = *Y0;
+        *Y0 = T;
+        T   = *X1;
+        *X1 = *Y1;
+        *Y1 = T;
+    }
+    if (Ctx->Map & PAINT_MAP_FLIPX) {
+        T   = *X0;
+        *X0 = Ctx->WidthMemory - *X1;
+        *X1 = Ctx->WidthMemory - T;
+    }
+    if (Ctx->Map & PAINT_MAP_FLIPY) {
+        T   = *Y0;
+        *Y0 = Ctx->HeightMemory - *Y1;
+        *Y1 = Ctx->HeightMemory - T;
+    }
+}
+
+/**
+ * Cost of growing R to cover R2 as well: pixels the union adds to R
+ **/
+static UDOUBLE Paint_DirtyGrowth(const PAINT_RECT *R, const PAINT_RECT *R2)
+{
+    UDOUBLE W = (R->X1 > R2->X1 ? R->X1 : R2->X1) - (R->X0 < R2->X0 ? R->X0 : R2->X0);
+    UDOUBLE H = (R->Y1 > R2->Y1 ? R->Y1 : R2->Y1) - (R->Y0 < R2->Y0 ? R->Y0 : R2->Y0);
+
+    return W * H - (UDOUBLE)(R->X1 - R->X0) * (R->Y1 - R->Y0);
+}
+
+/******************************************************************************
+function: Record a changed memory box [X0, X1) x [Y0, Y1), non-empty
+info:
+    Columns are widened to whole bytes of Image, which also covers a 4bpp
+    color above 0x0F spilling into the other nibble. The box absorbs every
+    rectangle it overlaps or touches, so text drawn cell by cell ends up as
+    one band. With PAINT_DIRTY_RECTS rectangles already apart, it is merged
+    into the one that grows the least.
+    Returns the rectangle that now holds the box.
+******************************************************************************/
+static const PAINT_RECT *Paint_DirtyAdd(PAINT *Ctx, UWORD X0, UWORD Y0, UWORD X1, UWORD Y1)
+{
+    UWORD       PerByte = 8 / Ctx->Bits;
+    PAINT_RECT  Box;
+    PAINT_RECT *R;
+    UDOUBLE     Growth, Least;
+    UWORD       i, Pick;
+
+    X0 -= X0 % PerByte;
+    X1 += (PerByte - X1 % PerByte) % PerByte;
+    if (X1 > Ctx->WidthMemory)
+        X1 = Ctx->WidthMemory;
+    Box.X0 = X0;
+    Box.Y0 = Y0;
+    Box.X1 = X1;
+    Box.Y1 = Y1;
+
+    for (i = 0; i < Ctx->DirtyCount; i++) { // Most writes land inside an earlier box
+        R = &Ctx->Dirty[i];
+        if (R->X0 <= X0 && X1 <= R->X1 && R->Y0 <= Y0 && Y1 <= R->Y1)
+            return R;
+    }
+
+    for (;;) {
+        for (Pick = 0; Pick < Ctx->DirtyCount; Pick++) {
+            R = &Ctx->Dirty[Pick];
+            if (R->X0 <= Box.X1 && Box.X0 <= R->X1 && R->Y0 <= Box.Y1 && Box.Y0 <= R->Y1)
+                break;
+        }
+        if (Pick == Ctx->DirtyCount) {
+            if (Ctx->DirtyCount < PAINT_DIRTY_RECTS)
+                break;
+            Least = 0xFFFFFFFF;
+            for (i = 0; i < Ctx->DirtyCount; i++) {
+                Growth = Paint_DirtyGrowth(&Ctx->Dirty[i], &Box);
+                if (Growth < Least) {
+                    Least = Growth;
+                    Pick  = i;
+                }
+            }
+        }
+        // Take Dirty[Pick] into the box and retry: the union may touch others
+        R = &Ctx->Dirty[Pick];
+        if (R->X0 < Box.X0)
+            Box.X0 = R->X0;
+        if (R->Y0 < Box.Y0)
+            Box.Y0 = R->Y0;
+        if (R->X1 > Box.X1)
+            Box.X1 = R->X1;
+        if (R->Y1 > Box.Y1)
+            Box.Y1 = R->Y1;
+        *R = Ctx->Dirty[--Ctx->DirtyCount];
+    }
+    Ctx->Dirty[Ctx->DirtyCount] = Box;
+    return &Ctx->Dirty[Ctx->DirtyCount++];
+}
+
+/**
+ * The whole image changed: one rectangle covers it
+ **/
+static void Paint_DirtyAll(PAINT *Ctx)
+{
+    Ctx->Dirty[0].X0 = 0;
+    Ctx->Dirty[0].Y0 = 0;
+    Ctx->Dirty[0].X1 = Ctx->WidthMemory;
+    Ctx->Dirty[0].Y1 = Ctx->HeightMemory;
+    Ctx->DirtyCount  = 1;
+
+    Ctx->DirtyHint.X0 = 0;
+    Ctx->DirtyHint.Y0 = 0;
+    Ctx->DirtyHint.X1 = Ctx->WidthClip;
+    Ctx->DirtyHint.Y1 = Ctx->HeightClip;
+}
+
+/**
+ * Memory box [X0, X1) x [Y0, Y1) back to the logical box it comes from, in place
+ **/
+static void Paint_UnmapBox(PAINT *Ctx, int *X0, int *Y0, int *X1, int *Y1)
+{
+    int T;
+
+    if (Ctx->Map & PAINT_MAP_FLIPY) {
+        T   = *Y0;
+        *Y0 = Ctx->HeightMemory - *Y1;
+        *Y1 = Ctx->HeightMemory - T;
+    }
+    if (Ctx->Map & PAINT_MAP_FLIPX) {
+        T   = *X0;
+        *X0 = Ctx->WidthMemory - *X1;
+        *X1 = Ctx->WidthMemory - T;
+    }
+    if (Ctx->Map & PAINT_MAP_SWAP) {
+        T   = *X0;
+        *X0 = *Y0;
+        *Y0 = T;
+        T   = *X1;
+        *X1 = *Y1;
+        *Y1 = T;
+    }
+}
+
+/******************************************************************************
+function: Record the logical box [Xstart, Xend) x [Ystart, Yend), clipped to the image
+info:
+    Primitives call it once with the box of everything they draw, their
+    pixel loops do not record. The rectangle holding the box is kept in
+    logical coordinates as DirtyHint for Paint_Ctx_SetPixel().
+******************************************************************************/
+static void Paint_Dirty(PAINT *Ctx, int Xstart, int Ystart, int Xend, int Yend)
+{
+    const PAINT_RECT *R;
+
+    if (Xstart < 0)
+        Xstart = 0;
+    if (Ystart < 0)
+        Ystart = 0;
+    if (Xend > Ctx->WidthClip)
+        Xend = Ctx->WidthClip;
+    if (Yend > Ctx->HeightClip)
+        Yend = Ctx->HeightClip;
+    if (Xstart >= Xend || Ystart >= Yend || Ctx->Bits == 0)
+        return;
+
+    Paint_MapBox(Ctx, &Xstart, &Ystart, &Xend, &Yend);
+    R      = Paint_DirtyAdd(Ctx, Xstart, Ystart, Xend, Yend);
+    Xstart = R->X0;
+    Ystart = R->Y0;
+    Xend   = R->X1;
+    Yend   = R->Y1;
+    Paint_UnmapBox(Ctx, &Xstart, &Ystart, &Xend, &Yend);
+    Ctx->DirtyHint.X0 = Xstart;
+    Ctx->DirtyHint.Y0 = Ystart;
+    Ctx->DirtyHint.X1 = Xend;
+    Ctx->DirtyHint.Y1 = Yend;
+}
+
+/******************************************************************************
+function: Fill the pixels [Xstart, Xend) x [Ystart, Yend), clipped to the image
+parameter:
+    Xstart : x starting point, may be negative
+    Ystart : Y starting point, may be negative
+    Xend   : x end point, exclusive
+    Yend   : y end point, exclusive
+    Color  : Painted colors
+info:
+    Rotation and mirroring map the box onto a box in memory, which is
+    filled row by row with Paint_FillSpan(). Not recorded as dirty, the
+    caller records its whole primitive.
+******************************************************************************/
+static void Paint_FillBox(PAINT *Ctx, int Xstart, int Ystart, int Xend, int Yend, UWORD Color)
+{
+    int   X0, X1, Y0, Y1;
+    UBYTE Fill;
+
+    if (Xstart < 0)
+        Xstart = 0;
+    if (Ystart < 0)
+        Ystart = 0;
+    if (Xend > Ctx->WidthClip)
+        Xend = Ctx->WidthClip;
+    if (Yend > Ctx->HeightClip)
+        Yend = Ctx->HeightClip;
+    if (Xstart >= Xend || Ystart >= Yend || Ctx->Bits == 0)
+        return;
+
+    X0 = Xstart;
+    Y0 = Ystart;
+    X1 = Xend;
+    Y1 = Yend;
+    Paint_MapBox(Ctx, &X0, &Y0, &X1, &Y1);
+
+    if (Ctx->Bits == 4 && Color > 0x0F) { // Spills into the neighbour pixel, which spans cannot repeat
+        for (Y0 = Ystart; Y0 < Yend; Y0++) {
+            for (X0 = Xstart; X0 < Xend; X0++) {
+                Paint_Ctx_SetPixelFast(Ctx, X0, Y0, Color);
+            }
+        }
+        return;
+    }
+
+    Fill = Paint_FillByte(Ctx, Color);
+    for (; Y0 < Y1; Y0++) {
+        Paint_FillSpan(Ctx, Y0, X0, X1, Fill);
+    }
+}
+
+/**
+ * Pixels of a solid horizontal or vertical line of Paint_DrawLine(): every
+ * point is a Line_width dot, which covers [X - Line_width, X + Line_width - 1)
+ **/
+static void Paint_LineBox(PAINT *Ctx, int Xstart, int Ystart, int Xend, int Yend, UWORD Color, int Line_width)
+{
+    int T;
+
+    if (Xstart > Xend) {
+        T      = Xstart;
+        Xstart = Xend;
+        Xend   = T;
+    }
+    if (Ystart > Yend) {
+        T      = Ystart;
+        Ystart = Yend;
+        Yend   = T;
+    }
+    Paint_Dirty(Ctx, Xstart - Line_width, Ystart - Line_width, Xend + Line_width - 1, Yend + Line_width - 1);
+    Paint_FillBox(Ctx, Xstart - Line_width, Ystart - Line_width, Xend + Line_width - 1, Yend + Line_width - 1, Color);
+}
+
+/**
+ * Paint_DrawPoint() without recording it, for the pixel loops of the other primitives
+ **/
+static void Paint_Dot(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, UWORD Color, DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_Style)
+{
+    if (Xpoint > Ctx->Width || Ypoint > Ctx->Height) {
+        Debug("Paint_DrawPoint Input exceeds the normal display range\r\n");
+        return;
+    }
+
+    if (Dot_Style == DOT_FILL_AROUND) {
+        Paint_FillBox(Ctx, Xpoint - Dot_Pixel, Ypoint - Dot_Pixel, Xpoint + Dot_Pixel - 1, Ypoint + Dot_Pixel - 1,
+                      Color);
+    } else {
+        Paint_FillBox(Ctx, Xpoint - 1, Ypoint - 1, Xpoint + Dot_Pixel - 1, Ypoint + Dot_Pixel - 1, Color);
+    }
+}
+
+/**
+ * Decode one packed character into Bits, rows of (Width + 7) / 8 bytes as in
+ * sFONT.table. Characters outside ' ' .. '~' decode blank.
+ **/
+static void Paint_FontDecode(UBYTE *Bits, const sFONT *Font, char Acsii_Char)
+{
+    UWORD          Stride = Font->Width / 8 + (Font->Width % 8 ? 1 : 0);
+    UBYTE          Index  = (UBYTE)Acsii_Char - ' ';
+    const uint8_t *Box, *ptr;
+    UBYTE         *Row, In = 0x80;
+    UWORD          Column, Page;
+
+    memset(Bits, 0, Font->Height * Stride);
+    if (Index >= '~' - ' ' + 1)
+        return;
+
+    Box = &Font->packed[Font->offsets[Index]]; // x, y, w, h, then w * h bits
+    ptr = Box + 4;
+    Row = &Bits[Box[1] * Stride];
+    for (Page = 0; Page < Box[3]; Page++, Row += Stride) {
+        for (Column = Box[0]; Column < Box[0] + Box[2]; Column++) {
+            if (*ptr & In)
+                Row[Column / 8] |= 0x80 >> (Column % 8);
+            In >>= 1;
+            if (In == 0) {
+                In = 0x80;
+                ptr++;
+            }
+        }
+    }
+}
+
+/**
+ * Bitmap of one character in the sFONT.table layout. Packed fonts are decoded
+ * into the least recently used slot of the context.
+ **/
+static const unsigned char *Paint_FontGlyph(PAINT *Ctx, const sFONT *Font, char Acsii_Char)
+{
+    if (Font->packed != NULL) {
+        PAINT_FONT_SLOT *Slot, *Oldest = &Ctx->Decoded[0];
+        UWORD            i;
+
+        if (Ctx->DecodeGeneration != Font_Generation) {
+            memset(Ctx->Decoded, 0, sizeof(Ctx->Decoded));
+            Ctx->DecodeClock      = 0;
+            Ctx->DecodeGeneration = Font_Generation;
+        }
+        Ctx->DecodeClock++;
+        for (i = 0; i < PAINT_FONT_SLOTS; i++) {
+            Slot = &Ctx->Decoded[i];
+            if (Slot->Font == Font && Slot->Char == Acsii_Char) {
+                Slot->Used = Ctx->DecodeClock;
+                return Slot->Bits;
+            }
+            if (Slot->Used < Oldest->Used)
+                Oldest = Slot;
+        }
+        Paint_FontDecode(Oldest->Bits, Font, Acsii_Char);
+        Oldest->Font = Font;
+        Oldest->Char = Acsii_Char;
+        Oldest->Used = Ctx->DecodeClock;
+        return Oldest->Bits;
+    }
+    uint32_t Char_Offset = (Acsii_Char - ' ') * Font->Height * (Font->Width / 8 + (Font->Width % 8 ? 1 : 0));
+    return &Font->table[Char_Offset];
+}
+
+/**
+ * Expand one character, ptr in the sFONT.table layout, into 4bpp nibble rows and their mask
+ **/
+static void Paint_GlyphExpand(PAINT_GLYPH *Glyph, sFONT *Font, const unsigned char *ptr, char Acsii_Char,
+                              UBYTE Foreground, UWORD Background, UBYTE Phase, UBYTE FlipX)
+{
+    UWORD  Page, Column, Pos;
+    UBYTE *Pixels, *Mask, Shift;
+
+    Glyph->Font       = Font;
+    Glyph->Char       = Acsii_Char;
+    Glyph->Foreground = Foreground;
+    Glyph->Background = Background;
+    Glyph->Phase      = Phase;
+    Glyph->FlipX      = FlipX;
+    Glyph->RowBytes   = (Phase + Font->Width + 1) / 2;
+
+    for (Page = 0; Page < Font->Height; Page++) {
+        Pixels = &Glyph->Pixels[Page * Glyph->RowBytes];
+        Mask   = &Glyph->Mask[Page * Glyph->RowBytes];
+        memset(Pixels, 0, Glyph->RowBytes);
+        memset(Mask, 0, Glyph->RowBytes);
+        for (Column = 0; Column < Font->Width; Column++) {
+            Pos   = Phase + (FlipX ? Font->Width - 1 - Column : Column);
+            Shift = (Pos % 2) ? 0 : 4; // Even x in the high nibble, as Paint_Put4()
+            if (*ptr & (0x80 >> (Column % 8))) {
+                Pixels[Pos / 2] |= Foreground << Shift;
+                Mask[Pos / 2] |= 0x0F << Shift;
+            } else if (Background != FONT_BACKGROUND) {
+                Pixels[Pos / 2] |= Background << Shift;
+                Mask[Pos / 2] |= 0x0F << Shift;
+            }
+            if (Column % 8 == 7)
+                ptr++;
+        }
+        if (Font->Width % 8 != 0)
+            ptr++;
+    }
+}
+
+/**
+ * Cached glyph, expanded into the least recently used slot on a miss
+ **/
+static const PAINT_GLYPH *Paint_GlyphGet(PAINT *Ctx, sFONT *Font, char Acsii_Char, UBYTE Foreground, UWORD Background,
+                                         UBYTE Phase, UBYTE FlipX)
+{
+    PAINT_GLYPH_CACHE *Cache = Ctx->Glyphs;
+    PAINT_GLYPH       *Glyph, *Oldest = &Cache->Slot[0];
+    UWORD              i;
+
+    if (Cache->Generation != Font_Generation) { // A font blob replaced glyphs
+        memset(Cache->Slot, 0, sizeof(Cache->Slot));
+        Cache->Clock      = 0;
+        Cache->Generation = Font_Generation;
+    }
+    Cache->Clock++;
+    for (i = 0; i < PAINT_GLYPH_SLOTS; i++) {
+        Glyph = &Cache->Slot[i];
+        if (Glyph->Font == Font && Glyph->Char == Acsii_Char && Glyph->Foreground == Foreground &&
+            Glyph->Background == Background && Glyph->Phase == Phase && Glyph->FlipX == FlipX) {
+            Glyph->Used = Cache->Clock;
+            Cache->Hits++;
+            return Glyph;
+        }
+        if (Glyph->Used < Oldest->Used)
+            Oldest = Glyph;
+    }
+
+    Cache->Misses++;
+    Paint_GlyphExpand(Oldest, Font, Paint_FontGlyph(Ctx, Font, Acsii_Char), Acsii_Char, Foreground, Background, Phase,
+                      FlipX);
+    Oldest->Used = Cache->Clock;
+    return Oldest;
+}
+
+/**
+ * Paint_DrawChar() through the glyph cache: one masked byte copy per nibble pair.
+ * Returns 0 when the canvas, the colors or the position need the per-pixel path.
+ **/
+static UBYTE Paint_DrawGlyph(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, char Acsii_Char, sFONT *Font,
+                             UWORD Color_Foreground, UWORD Color_Background)
+{
+    const PAINT_GLYPH *Glyph;
+    const UBYTE       *Pixels, *Mask;
+    UBYTE             *Row;
+    UWORD              X0, Y, Page, i;
+
+    if (Ctx->Glyphs == NULL || Ctx->Bits != 4 || (Ctx->Map & PAINT_MAP_SWAP))
+        return 0;
+    if (Font->Width > PAINT_GLYPH_MAX_W || Font->Height > PAINT_GLYPH_MAX_H)
+        return 0;
+    if (Color_Foreground > 0x0F || (Color_Background != FONT_BACKGROUND && Color_Background > 0x0F))
+        return 0;
+    if ((UDOUBLE)Xpoint + Font->Width > Ctx->WidthClip || (UDOUBLE)Ypoint + Font->Height > Ctx->HeightClip)
+        return 0;
+
+    X0    = (Ctx->Map & PAINT_MAP_FLIPX) ? Ctx->WidthMemory - Xpoint - Font->Width : Xpoint;
+    Glyph = Paint_GlyphGet(Ctx, Font, Acsii_Char, Color_Foreground, Color_Background, X0 % 2,
+                           (Ctx->Map & PAINT_MAP_FLIPX) != 0);
+
+    for (Page = 0; Page < Font->Height; Page++) {
+        Y      = (Ctx->Map & PAINT_MAP_FLIPY) ? Ctx->HeightMemory - 1 - (Ypoint + Page) : Ypoint + Page;
+        Row    = &Ctx->Image[(UDOUBLE)Y * Ctx->WidthByte + X0 / 2];
+        Pixels = &Glyph->Pixels[Page * Glyph->RowBytes];
+        Mask   = &Glyph->Mask[Page * Glyph->RowBytes];
+        for (i = 0; i < Glyph->RowBytes; i++) {
+            Row[i] = (Row[i] & ~Mask[i]) | Pixels[i];
+        }
+    }
+    return 1;
+}
 
 /******************************************************************************
 function: Create Image
@@ -93,30 +791,36 @@ parameter:
     Height  :   The height of the picture
     Color   :   Whether the picture is inverted
 ******************************************************************************/
-void Paint_NewImage(UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color)
+void Paint_Ctx_NewImage(PAINT *Ctx, UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color)
 {
-    Paint.Image = NULL;
-    Paint.Image = image;
+    Ctx->Image = NULL;
+    Ctx->Image = image;
 
-    Paint.WidthMemory  = Width;
-    Paint.HeightMemory = Height;
-    Paint.Color        = Color;
-    Paint.Scale        = 2;
-    Paint.WidthByte    = (Width % 8 == 0) ? (Width / 8) : (Width / 8 + 1);
-    Paint.HeightByte   = Height;
-    //    printf("WidthByte = %d, HeightByte = %d\r\n", Paint.WidthByte, Paint.HeightByte);
+    Ctx->WidthMemory  = Width;
+    Ctx->HeightMemory = Height;
+    Ctx->Color        = Color;
+    Ctx->Scale        = 2;
+    Ctx->WidthByte    = (Width % 8 == 0) ? (Width / 8) : (Width / 8 + 1);
+    Ctx->HeightByte   = Height;
+    //    printf("WidthByte = %d, HeightByte = %d\r\n", Ctx->WidthByte, Ctx->HeightByte);
     //    printf(" EPD_WIDTH / 8 = %d\r\n",  122 / 8);
 
-    Paint.Rotate = Rotate;
-    Paint.Mirror = MIRROR_NONE;
+    Ctx->Rotate = Rotate;
+    Ctx->Mirror = MIRROR_NONE;
 
     if (Rotate == ROTATE_0 || Rotate == ROTATE_180) {
-        Paint.Width  = Width;
-        Paint.Height = Height;
+        Ctx->Width  = Width;
+        Ctx->Height = Height;
     } else {
-        Paint.Width  = Height;
-        Paint.Height = Width;
+        Ctx->Width  = Height;
+        Ctx->Height = Width;
     }
+    Ctx->Glyphs = NULL;
+    memset(Ctx->Decoded, 0, sizeof(Ctx->Decoded));
+    Ctx->DecodeClock      = 0;
+    Ctx->DecodeGeneration = Font_Generation;
+    Paint_Bind(Ctx);
+    Paint_DirtyAll(Ctx); // Nothing is known about the contents yet
 }
 
 /******************************************************************************
@@ -124,9 +828,10 @@ function: Select Image
 parameter:
     image : Pointer to the image cache
 ******************************************************************************/
-void Paint_SelectImage(UBYTE *image)
+void Paint_Ctx_SelectImage(PAINT *Ctx, UBYTE *image)
 {
-    Paint.Image = image;
+    Ctx->Image = image;
+    Paint_DirtyAll(Ctx);
 }
 
 /******************************************************************************
@@ -134,11 +839,12 @@ function: Select Image Rotate
 parameter:
     Rotate : 0,90,180,270
 ******************************************************************************/
-void Paint_SetRotate(UWORD Rotate)
+void Paint_Ctx_SetRotate(PAINT *Ctx, UWORD Rotate)
 {
     if (Rotate == ROTATE_0 || Rotate == ROTATE_90 || Rotate == ROTATE_180 || Rotate == ROTATE_270) {
         // Debug("Set image Rotate %d\r\n", Rotate);
-        Paint.Rotate = Rotate;
+        Ctx->Rotate = Rotate;
+        Paint_Bind(Ctx);
     } else {
         Debug("rotate = 0, 90, 180, 270\r\n");
     }
@@ -149,34 +855,54 @@ function:	Select Image mirror
 parameter:
     mirror   :Not mirror,Horizontal mirror,Vertical mirror,Origin mirror
 ******************************************************************************/
-void Paint_SetMirroring(UBYTE mirror)
+void Paint_Ctx_SetMirroring(PAINT *Ctx, UBYTE mirror)
 {
     if (mirror == MIRROR_NONE || mirror == MIRROR_HORIZONTAL || mirror == MIRROR_VERTICAL || mirror == MIRROR_ORIGIN) {
         // Debug("mirror image x:%s, y:%s\r\n",(mirror & 0x01)? "mirror":"none", ((mirror >> 1) & 0x01)?
         // "mirror":"none");
-        Paint.Mirror = mirror;
+        Ctx->Mirror = mirror;
+        Paint_Bind(Ctx);
     } else {
         Debug("mirror should be MIRROR_NONE, MIRROR_HORIZONTAL, \
         MIRROR_VERTICAL or MIRROR_ORIGIN\r\n");
     }
 }
 
-void Paint_SetScale(UBYTE scale)
+void Paint_Ctx_SetScale(PAINT *Ctx, UBYTE scale)
 {
     if (scale == 2) {
-        Paint.Scale     = scale;
-        Paint.WidthByte = (Paint.WidthMemory % 8 == 0) ? (Paint.WidthMemory / 8) : (Paint.WidthMemory / 8 + 1);
+        Ctx->Scale     = scale;
+        Ctx->WidthByte = (Ctx->WidthMemory % 8 == 0) ? (Ctx->WidthMemory / 8) : (Ctx->WidthMemory / 8 + 1);
     } else if (scale == 4) {
-        Paint.Scale     = scale;
-        Paint.WidthByte = (Paint.WidthMemory % 4 == 0) ? (Paint.WidthMemory / 4) : (Paint.WidthMemory / 4 + 1);
+        Ctx->Scale     = scale;
+        Ctx->WidthByte = (Ctx->WidthMemory % 4 == 0) ? (Ctx->WidthMemory / 4) : (Ctx->WidthMemory / 4 + 1);
     } else if (scale == 7) { // Only applicable with 5in65 e-Paper
-        Paint.Scale     = 7;
-        Paint.WidthByte = (Paint.WidthMemory % 2 == 0) ? (Paint.WidthMemory / 2) : (Paint.WidthMemory / 2 + 1);
+        Ctx->Scale     = 7;
+        Ctx->WidthByte = (Ctx->WidthMemory % 2 == 0) ? (Ctx->WidthMemory / 2) : (Ctx->WidthMemory / 2 + 1);
     } else {
         Debug("Set Scale Input parameter error\r\n");
         Debug("Scale Only support: 2 4 7\r\n");
+        return;
     }
+    Paint_Bind(Ctx);
+    Paint_DirtyAll(Ctx); // Rows have a new layout
 }
+
+/******************************************************************************
+function: Attach a glyph cache to the context
+parameter:
+    Cache : Emptied and used by Paint_Ctx_DrawChar(), NULL for none
+info:
+    Paint_Ctx_NewImage() detaches it. Like the context, a cache must not
+    be used by two threads at once.
+******************************************************************************/
+void Paint_Ctx_SetGlyphCache(PAINT *Ctx, PAINT_GLYPH_CACHE *Cache)
+{
+    if (Cache != NULL)
+        memset(Cache, 0, sizeof(PAINT_GLYPH_CACHE));
+    Ctx->Glyphs = Cache;
+}
+
 /******************************************************************************
 function: Draw Pixels
 parameter:
@@ -184,77 +910,16 @@ parameter:
     Ypoint : At point Y
     Color  : Painted colors
 ******************************************************************************/
-void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
+void Paint_Ctx_SetPixel(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, UWORD Color)
 {
-    if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
-        Debug("Exceeding display boundaries\r\n");
-        return;
-    }
-    UWORD X, Y;
-    switch (Paint.Rotate) {
-    case 0:
-        X = Xpoint;
-        Y = Ypoint;
-        break;
-    case 90:
-        X = Paint.WidthMemory - Ypoint - 1;
-        Y = Xpoint;
-        break;
-    case 180:
-        X = Paint.WidthMemory - Xpoint - 1;
-        Y = Paint.HeightMemory - Ypoint - 1;
-        break;
-    case 270:
-        X = Ypoint;
-        Y = Paint.HeightMemory - Xpoint - 1;
-        break;
-    default:
-        return;
-    }
-
-    switch (Paint.Mirror) {
-    case MIRROR_NONE:
-        break;
-    case MIRROR_HORIZONTAL:
-        X = Paint.WidthMemory - X - 1;
-        break;
-    case MIRROR_VERTICAL:
-        Y = Paint.HeightMemory - Y - 1;
-        break;
-    case MIRROR_ORIGIN:
-        X = Paint.WidthMemory - X - 1;
-        Y = Paint.HeightMemory - Y - 1;
-        break;
-    default:
-        return;
-    }
-
-    if (X > Paint.WidthMemory || Y > Paint.HeightMemory) {
+    if (Xpoint >= Ctx->WidthClip || Ypoint >= Ctx->HeightClip) {
         Debug("Exceeding display boundaries\r\n");
         return;
     }
-
-    if (Paint.Scale == 2) {
-        UDOUBLE Addr  = X / 8 + Y * Paint.WidthByte;
-        UBYTE   Rdata = Paint.Image[Addr];
-        if (Color == BLACK)
-            Paint.Image[Addr] = Rdata & ~(0x80 >> (X % 8));
-        else
-            Paint.Image[Addr] = Rdata | (0x80 >> (X % 8));
-    } else if (Paint.Scale == 4) {
-        UDOUBLE Addr = X / 4 + Y * Paint.WidthByte;
-        Color        = Color % 4; // Guaranteed color scale is 4  --- 0~3
-        UBYTE Rdata  = Paint.Image[Addr];
-
-        Rdata             = Rdata & (~(0xC0 >> ((X % 4) * 2)));
-        Paint.Image[Addr] = Rdata | ((Color << 6) >> ((X % 4) * 2));
-    } else if (Paint.Scale == 7 || Paint.Scale == 16) {
-        UDOUBLE Addr      = X / 2 + Y * Paint.WidthByte;
-        UBYTE   Rdata     = Paint.Image[Addr];
-        Rdata             = Rdata & (~(0xF0 >> ((X % 2) * 4))); // Clear first, then set value
-        Paint.Image[Addr] = Rdata | ((Color << 4) >> ((X % 2) * 4));
-        // printf("Add =  %d ,data = %d\r\n",Addr,Rdata);
-    }
+    if (Xpoint < Ctx->DirtyHint.X0 || Xpoint >= Ctx->DirtyHint.X1 || Ypoint < Ctx->DirtyHint.Y0 ||
+        Ypoint >= Ctx->DirtyHint.Y1) // Most pixels land next to the previous one
+        Paint_Dirty(Ctx, Xpoint, Ypoint, Xpoint + 1, Ypoint + 1);
+    Ctx->SetPixel(Ctx, Xpoint, Ypoint, Color);
 }
 
 /******************************************************************************
@@ -262,29 +927,17 @@ function: Clear the color of the picture
 parameter:
     Color : Painted colors
 ******************************************************************************/
-void Paint_Clear(UWORD Color)
+void Paint_Ctx_Clear(PAINT *Ctx, UWORD Color)
 {
-    if (Paint.Scale == 2) {
-        for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
-            for (UWORD X = 0; X < Paint.WidthByte; X++) { // 8 pixel =  1 byte
-                UDOUBLE Addr      = X + Y * Paint.WidthByte;
-                Paint.Image[Addr] = Color;
-            }
-        }
-    } else if (Paint.Scale == 4) {
-        for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
-            for (UWORD X = 0; X < Paint.WidthByte; X++) {
-                UDOUBLE Addr      = X + Y * Paint.WidthByte;
-                Paint.Image[Addr] = (Color << 6) | (Color << 4) | (Color << 2) | Color;
-            }
-        }
-    } else if (Paint.Scale == 7 || Paint.Scale == 16) {
-        for (UWORD Y = 0; Y < Paint.HeightByte; Y++) {
-            for (UWORD X = 0; X < Paint.WidthByte; X++) {
-                UDOUBLE Addr      = X + Y * Paint.WidthByte;
-                Paint.Image[Addr] = (Color << 4) | Color;
-            }
-        }
+    UDOUBLE Size = (UDOUBLE)Ctx->WidthByte * Ctx->HeightByte;
+
+    Paint_DirtyAll(Ctx);
+    if (Ctx->Scale == 2) {
+        memset(Ctx->Image, Color, Size); // 8 pixel =  1 byte
+    } else if (Ctx->Scale == 4) {
+        memset(Ctx->Image, (Color << 6) | (Color << 4) | (Color << 2) | Color, Size);
+    } else if (Ctx->Scale == 7 || Ctx->Scale == 16) {
+        memset(Ctx->Image, (Color << 4) | Color, Size);
     }
 }
 
@@ -297,14 +950,10 @@ parameter:
     Yend   : y end point
     Color  : Painted colors
 ******************************************************************************/
-void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
+void Paint_Ctx_ClearWindows(PAINT *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
 {
-    UWORD X, Y;
-    for (Y = Ystart; Y < Yend; Y++) {
-        for (X = Xstart; X < Xend; X++) { // 8 pixel =  1 byte
-            Paint_SetPixel(X, Y, Color);
-        }
-    }
+    Paint_Dirty(Ctx, Xstart, Ystart, Xend, Yend);
+    Paint_FillBox(Ctx, Xstart, Ystart, Xend, Yend, Color);
 }
 
 /******************************************************************************
@@ -316,30 +965,11 @@ parameter:
     Dot_Pixel	: point size
     Dot_Style	: point Style
 ******************************************************************************/
-void Paint_DrawPoint(UWORD Xpoint, UWORD Ypoint, UWORD Color, DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_Style)
+void Paint_Ctx_DrawPoint(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, UWORD Color, DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_Style)
 {
-    if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
-        Debug("Paint_DrawPoint Input exceeds the normal display range\r\n");
-        return;
-    }
-
-    int16_t XDir_Num, YDir_Num;
-    if (Dot_Style == DOT_FILL_AROUND) {
-        for (XDir_Num = 0; XDir_Num < 2 * Dot_Pixel - 1; XDir_Num++) {
-            for (YDir_Num = 0; YDir_Num < 2 * Dot_Pixel - 1; YDir_Num++) {
-                if (Xpoint + XDir_Num - Dot_Pixel < 0 || Ypoint + YDir_Num - Dot_Pixel < 0)
-                    break;
-                // printf("x = %d, y = %d\r\n", Xpoint + XDir_Num - Dot_Pixel, Ypoint + YDir_Num - Dot_Pixel);
-                Paint_SetPixel(Xpoint + XDir_Num - Dot_Pixel, Ypoint + YDir_Num - Dot_Pixel, Color);
-            }
-        }
-    } else {
-        for (XDir_Num = 0; XDir_Num < Dot_Pixel; XDir_Num++) {
-            for (YDir_Num = 0; YDir_Num < Dot_Pixel; YDir_Num++) {
-                Paint_SetPixel(Xpoint + XDir_Num - 1, Ypoint + YDir_Num - 1, Color);
-            }
-        }
-    }
+    if (Xpoint <= Ctx->Width && Ypoint <= Ctx->Height) // Holds the dot of either style
+        Paint_Dirty(Ctx, Xpoint - Dot_Pixel, Ypoint - Dot_Pixel, Xpoint + Dot_Pixel, Ypoint + Dot_Pixel);
+    Paint_Dot(Ctx, Xpoint, Ypoint, Color, Dot_Pixel, Dot_Style);
 }
 
 /******************************************************************************
@@ -353,14 +983,23 @@ parameter:
     Line_width : Line width
     Line_Style: Solid and dotted lines
 ******************************************************************************/
-void Paint_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width,
-                    LINE_STYLE Line_Style)
+void Paint_Ctx_DrawLine(PAINT *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color,
+                        DOT_PIXEL Line_width, LINE_STYLE Line_Style)
 {
-    if (Xstart > Paint.Width || Ystart > Paint.Height || Xend > Paint.Width || Yend > Paint.Height) {
+    if (Xstart > Ctx->Width || Ystart > Ctx->Height || Xend > Ctx->Width || Yend > Ctx->Height) {
         Debug("Paint_DrawLine Input exceeds the normal display range\r\n");
         return;
     }
 
+    if (Line_Style == LINE_STYLE_SOLID && (Xstart == Xend || Ystart == Yend)) {
+        Paint_LineBox(Ctx, Xstart, Ystart, Xend, Yend, Color, Line_width);
+        return;
+    }
+
+    // Every dot covers [X - Line_width, X + Line_width - 1), see Paint_LineBox()
+    Paint_Dirty(Ctx, (Xstart < Xend ? Xstart : Xend) - Line_width, (Ystart < Yend ? Ystart : Yend) - Line_width,
+                (Xstart > Xend ? Xstart : Xend) + Line_width - 1, (Ystart > Yend ? Ystart : Yend) + Line_width - 1);
+
     UWORD Xpoint = Xstart;
     UWORD Ypoint = Ystart;
     int   dx     = (int)Xend - (int)Xstart >= 0 ? Xend - Xstart : Xstart - Xend;
@@ -379,10 +1018,10 @@ void Paint_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Co
         // Painted dotted line, 2 point is really virtual
         if (Line_Style == LINE_STYLE_DOTTED && Dotted_Len % 3 == 0) {
             // Debug("LINE_DOTTED\r\n");
-            Paint_DrawPoint(Xpoint, Ypoint, IMAGE_BACKGROUND, Line_width, DOT_STYLE_DFT);
+            Paint_Dot(Ctx, Xpoint, Ypoint, IMAGE_BACKGROUND, Line_width, DOT_STYLE_DFT);
             Dotted_Len = 0;
         } else {
-            Paint_DrawPoint(Xpoint, Ypoint, Color, Line_width, DOT_STYLE_DFT);
+            Paint_Dot(Ctx, Xpoint, Ypoint, Color, Line_width, DOT_STYLE_DFT);
         }
         if (2 * Esp >= dy) {
             if (Xpoint == Xend)
@@ -410,24 +1049,23 @@ parameter:
     Line_width: Line width
     Draw_Fill : Whether to fill the inside of the rectangle
 ******************************************************************************/
-void Paint_DrawRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width,
-                         DRAW_FILL Draw_Fill)
+void Paint_Ctx_DrawRectangle(PAINT *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color,
+                             DOT_PIXEL Line_width, DRAW_FILL Draw_Fill)
 {
-    if (Xstart > Paint.Width || Ystart > Paint.Height || Xend > Paint.Width || Yend > Paint.Height) {
+    if (Xstart > Ctx->Width || Ystart > Ctx->Height || Xend > Ctx->Width || Yend > Ctx->Height) {
         Debug("Input exceeds the normal display range\r\n");
         return;
     }
 
     if (Draw_Fill) {
-        UWORD Ypoint;
-        for (Ypoint = Ystart; Ypoint < Yend; Ypoint++) {
-            Paint_DrawLine(Xstart, Ypoint, Xend, Ypoint, Color, Line_width, LINE_STYLE_SOLID);
-        }
+        // One solid line per row from Ystart to Yend - 1
+        if (Yend > Ystart)
+            Paint_LineBox(Ctx, Xstart, Ystart, Xend, Yend - 1, Color, Line_width);
     } else {
-        Paint_DrawLine(Xstart, Ystart, Xend, Ystart, Color, Line_width, LINE_STYLE_SOLID);
-        Paint_DrawLine(Xstart, Ystart, Xstart, Yend, Color, Line_width, LINE_STYLE_SOLID);
-        Paint_DrawLine(Xend, Yend, Xend, Ystart, Color, Line_width, LINE_STYLE_SOLID);
-        Paint_DrawLine(Xend, Yend, Xstart, Yend, Color, Line_width, LINE_STYLE_SOLID);
+        Paint_Ctx_DrawLine(Ctx, Xstart, Ystart, Xend, Ystart, Color, Line_width, LINE_STYLE_SOLID);
+        Paint_Ctx_DrawLine(Ctx, Xstart, Ystart, Xstart, Yend, Color, Line_width, LINE_STYLE_SOLID);
+        Paint_Ctx_DrawLine(Ctx, Xend, Yend, Xend, Ystart, Color, Line_width, LINE_STYLE_SOLID);
+        Paint_Ctx_DrawLine(Ctx, Xend, Yend, Xstart, Yend, Color, Line_width, LINE_STYLE_SOLID);
     }
 }
 
@@ -442,14 +1080,18 @@ parameter:
     Line_width: Line width
     Draw_Fill : Whether to fill the inside of the Circle
 ******************************************************************************/
-void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Color, DOT_PIXEL Line_width,
-                      DRAW_FILL Draw_Fill)
+void Paint_Ctx_DrawCircle(PAINT *Ctx, UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Color, DOT_PIXEL Line_width,
+                          DRAW_FILL Draw_Fill)
 {
-    if (X_Center > Paint.Width || Y_Center >= Paint.Height) {
+    if (X_Center > Ctx->Width || Y_Center >= Ctx->Height) {
         Debug("Paint_DrawCircle Input exceeds the normal display range\r\n");
         return;
     }
 
+    // Filled runs start one pixel up and left, outline dots Line_width before the point
+    Paint_Dirty(Ctx, X_Center - Radius - Line_width, Y_Center - Radius - Line_width, X_Center + Radius + Line_width,
+                Y_Center + Radius + Line_width);
+
     // Draw a circle from(0, R) as a starting point
     int16_t XCurrent, YCurrent;
     XCurrent = 0;
@@ -458,19 +1100,18 @@ void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Color,
     // Cumulative error,judge the next point of the logo
     int16_t Esp = 3 - (Radius << 1);
 
-    int16_t sCountY;
     if (Draw_Fill == DRAW_FILL_FULL) {
-        while (XCurrent <= YCurrent) { // Realistic circles
-            for (sCountY = XCurrent; sCountY <= YCurrent; sCountY++) {
-                Paint_DrawPoint(X_Center + XCurrent, Y_Center + sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT); // 1
-                Paint_DrawPoint(X_Center - XCurrent, Y_Center + sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT); // 2
-                Paint_DrawPoint(X_Center - sCountY, Y_Center + XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT); // 3
-                Paint_DrawPoint(X_Center - sCountY, Y_Center - XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT); // 4
-                Paint_DrawPoint(X_Center - XCurrent, Y_Center - sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT); // 5
-                Paint_DrawPoint(X_Center + XCurrent, Y_Center - sCountY, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT); // 6
-                Paint_DrawPoint(X_Center + sCountY, Y_Center - XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT); // 7
-                Paint_DrawPoint(X_Center + sCountY, Y_Center + XCurrent, Color, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-            }
+        int Cx = X_Center - 1, Cy = Y_Center - 1; // A 1x1 dot lands one pixel up and left
+        while (XCurrent <= YCurrent) {            // Realistic circles
+            // The eight octant runs from XCurrent out to YCurrent: four columns, four rows
+            Paint_FillBox(Ctx, Cx + XCurrent, Cy + XCurrent, Cx + XCurrent + 1, Cy + YCurrent + 1, Color); // 1
+            Paint_FillBox(Ctx, Cx - XCurrent, Cy + XCurrent, Cx - XCurrent + 1, Cy + YCurrent + 1, Color); // 2
+            Paint_FillBox(Ctx, Cx - YCurrent, Cy + XCurrent, Cx - XCurrent + 1, Cy + XCurrent + 1, Color); // 3
+            Paint_FillBox(Ctx, Cx - YCurrent, Cy - XCurrent, Cx - XCurrent + 1, Cy - XCurrent + 1, Color); // 4
+            Paint_FillBox(Ctx, Cx - XCurrent, Cy - YCurrent, Cx - XCurrent + 1, Cy - XCurrent + 1, Color); // 5
+            Paint_FillBox(Ctx, Cx + XCurrent, Cy - YCurrent, Cx + XCurrent + 1, Cy - XCurrent + 1, Color); // 6
+            Paint_FillBox(Ctx, Cx + XCurrent, Cy - XCurrent, Cx + YCurrent + 1, Cy - XCurrent + 1, Color); // 7
+            Paint_FillBox(Ctx, Cx + XCurrent, Cy + XCurrent, Cx + YCurrent + 1, Cy + XCurrent + 1, Color); // 0
             if (Esp < 0)
                 Esp += 4 * XCurrent + 6;
             else {
@@ -481,14 +1122,14 @@ void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Color,
         }
     } else { // Draw a hollow circle
         while (XCurrent <= YCurrent) {
-            Paint_DrawPoint(X_Center + XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT); // 1
-            Paint_DrawPoint(X_Center - XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT); // 2
-            Paint_DrawPoint(X_Center - YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT); // 3
-            Paint_DrawPoint(X_Center - YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT); // 4
-            Paint_DrawPoint(X_Center - XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT); // 5
-            Paint_DrawPoint(X_Center + XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT); // 6
-            Paint_DrawPoint(X_Center + YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT); // 7
-            Paint_DrawPoint(X_Center + YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT); // 0
+            Paint_Dot(Ctx, X_Center + XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT); // 1
+            Paint_Dot(Ctx, X_Center - XCurrent, Y_Center + YCurrent, Color, Line_width, DOT_STYLE_DFT); // 2
+            Paint_Dot(Ctx, X_Center - YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT); // 3
+            Paint_Dot(Ctx, X_Center - YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT); // 4
+            Paint_Dot(Ctx, X_Center - XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT); // 5
+            Paint_Dot(Ctx, X_Center + XCurrent, Y_Center - YCurrent, Color, Line_width, DOT_STYLE_DFT); // 6
+            Paint_Dot(Ctx, X_Center + YCurrent, Y_Center - XCurrent, Color, Line_width, DOT_STYLE_DFT); // 7
+            Paint_Dot(Ctx, X_Center + YCurrent, Y_Center + XCurrent, Color, Line_width, DOT_STYLE_DFT); // 0
 
             if (Esp < 0)
                 Esp += 4 * XCurrent + 6;
@@ -501,28 +1142,29 @@ void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Color,
     }
 }
 
-/******************************************************************************
-function: Show English characters
-parameter:
-    Xpoint           ：X coordinate
-    Ypoint           ：Y coordinate
-    Acsii_Char       ：To display the English characters
-    Font             ：A structure pointer that displays a character size
-    Color_Foreground : Select the foreground color
-    Color_Background : Select the background color
-******************************************************************************/
-void Paint_DrawChar(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char, sFONT *Font, UWORD Color_Foreground,
-                    UWORD Color_Background)
+/**
+ * Paint_DrawChar() without recording the cell, 0 if nothing was drawn
+ **/
+static UBYTE Paint_CharCell(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, const char Acsii_Char, sFONT *Font,
+                            UWORD Color_Foreground, UWORD Color_Background)
 {
     UWORD Page, Column;
 
-    if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
+    if (Xpoint > Ctx->Width || Ypoint > Ctx->Height) {
         Debug("Paint_DrawChar Input exceeds the normal display range\r\n");
-        return;
+        return 0;
+    }
+    if (Font->table == NULL &&
+        (Font->packed == NULL || Font->Height * (Font->Width / 8 + (Font->Width % 8 ? 1 : 0)) > PAINT_FONT_BYTES)) {
+        Debug("Paint_DrawChar Font has no glyphs to draw\r\n");
+        return 0;
     }
 
-    uint32_t Char_Offset     = (Acsii_Char - ' ') * Font->Height * (Font->Width / 8 + (Font->Width % 8 ? 1 : 0));
-    const unsigned char *ptr = &Font->table[Char_Offset];
+    if (Paint_DrawGlyph(Ctx, Xpoint, Ypoint, Acsii_Char, Font, Color_Foreground, Color_Background))
+        return 1;
+
+    const unsigned char *ptr = Paint_FontGlyph(Ctx, Font, Acsii_Char);
+    PAINT_PIXEL_FN       Put = Paint_BlockWriter(Ctx, Xpoint, Ypoint, Font->Width, Font->Height);
 
     for (Page = 0; Page < Font->Height; Page++) {
         for (Column = 0; Column < Font->Width; Column++) {
@@ -530,14 +1172,14 @@ void Paint_DrawChar(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char, sFONT *Fo
             // To determine whether the font background color and screen background color is consistent
             if (FONT_BACKGROUND == Color_Background) { // this process is to speed up the scan
                 if (*ptr & (0x80 >> (Column % 8)))
-                    Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Foreground);
+                    Put(Ctx, Xpoint + Column, Ypoint + Page, Color_Foreground);
                 // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
             } else {
                 if (*ptr & (0x80 >> (Column % 8))) {
-                    Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Foreground);
+                    Put(Ctx, Xpoint + Column, Ypoint + Page, Color_Foreground);
                     // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
                 } else {
-                    Paint_SetPixel(Xpoint + Column, Ypoint + Page, Color_Background);
+                    Put(Ctx, Xpoint + Column, Ypoint + Page, Color_Background);
                     // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
                 }
             }
@@ -548,6 +1190,24 @@ void Paint_DrawChar(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char, sFONT *Fo
         if (Font->Width % 8 != 0)
             ptr++;
     } // Write all
+    return 1;
+}
+
+/******************************************************************************
+function: Show English characters
+parameter:
+    Xpoint           ：X coordinate
+    Ypoint           ：Y coordinate
+    Acsii_Char       ：To display the English characters
+    Font             ：A structure pointer that displays a character size
+    Color_Foreground : Select the foreground color
+    Color_Background : Select the background color
+******************************************************************************/
+void Paint_Ctx_DrawChar(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, const char Acsii_Char, sFONT *Font,
+                        UWORD Color_Foreground, UWORD Color_Background)
+{
+    if (Paint_CharCell(Ctx, Xpoint, Ypoint, Acsii_Char, Font, Color_Foreground, Color_Background))
+        Paint_Dirty(Ctx, Xpoint, Ypoint, Xpoint + Font->Width, Ypoint + Font->Height);
 }
 
 /******************************************************************************
@@ -560,30 +1220,36 @@ parameter:
     Color_Foreground : Select the foreground color
     Color_Background : Select the background color
 ******************************************************************************/
-void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char *pString, sFONT *Font, UWORD Color_Foreground,
-                         UWORD Color_Background)
+void Paint_Ctx_DrawString_EN(PAINT *Ctx, UWORD Xstart, UWORD Ystart, const char *pString, sFONT *Font,
+                             UWORD Color_Foreground, UWORD Color_Background)
 {
     UWORD Xpoint = Xstart;
     UWORD Ypoint = Ystart;
+    int   Xmax   = Xstart, Ymax = Ystart; // Wrapped lines restart at Xstart, Ystart
 
-    if (Xstart > Paint.Width || Ystart > Paint.Height) {
+    if (Xstart > Ctx->Width || Ystart > Ctx->Height) {
         Debug("Paint_DrawString_EN Input exceeds the normal display range\r\n");
         return;
     }
 
     while (*pString != '\0') {
         // if X direction filled , reposition to(Xstart,Ypoint),Ypoint is Y direction plus the Height of the character
-        if ((Xpoint + Font->Width) > Paint.Width) {
+        if ((Xpoint + Font->Width) > Ctx->Width) {
             Xpoint = Xstart;
             Ypoint += Font->Height;
         }
 
         // If the Y direction is full, reposition to(Xstart, Ystart)
-        if ((Ypoint + Font->Height) > Paint.Height) {
+        if ((Ypoint + Font->Height) > Ctx->Height) {
             Xpoint = Xstart;
             Ypoint = Ystart;
         }
-        Paint_DrawChar(Xpoint, Ypoint, *pString, Font, Color_Foreground, Color_Background);
+        if (Paint_CharCell(Ctx, Xpoint, Ypoint, *pString, Font, Color_Foreground, Color_Background)) {
+            if (Xpoint + Font->Width > Xmax)
+                Xmax = Xpoint + Font->Width;
+            if (Ypoint + Font->Height > Ymax)
+                Ymax = Ypoint + Font->Height;
+        }
 
         // The next character of the address
         pString++;
@@ -591,6 +1257,165 @@ void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char *pString, sFONT
         // The next word of the abscissa increases the font of the broadband
         Xpoint += Font->Width;
     }
+    Paint_Dirty(Ctx, Xstart, Ystart, Xmax, Ymax);
+}
+
+#define PAINT_UTF8_INVALID 0xFFFFFFFF
+
+/**
+ * Next code point of a UTF-8 string, PAINT_UTF8_INVALID for a malformed or
+ * truncated sequence; *pText moves past it, at least one byte
+ **/
+static uint32_t Paint_Utf8Next(const char **pText)
+{
+    const unsigned char *p = (const unsigned char *)*pText;
+    uint32_t             Code, Min;
+    UBYTE                Len, i;
+
+    if (p[0] < 0x80) {
+        *pText += 1;
+        return p[0];
+    } else if ((p[0] & 0xE0) == 0xC0) {
+        Code = p[0] & 0x1F;
+        Len  = 2;
+        Min  = 0x80;
+    } else if ((p[0] & 0xF0) == 0xE0) {
+        Code = p[0] & 0x0F;
+        Len  = 3;
+        Min  = 0x800;
+    } else if ((p[0] & 0xF8) == 0xF0) {
+        Code = p[0] & 0x07;
+        Len  = 4;
+        Min  = 0x10000;
+    } else {
+        *pText += 1;
+        return PAINT_UTF8_INVALID;
+    }
+
+    for (i = 1; i < Len; i++) {
+        if ((p[i] & 0xC0) != 0x80) { // Also stops at the terminating 0
+            *pText += i;
+            return PAINT_UTF8_INVALID;
+        }
+        Code = (Code << 6) | (p[i] & 0x3F);
+    }
+    *pText += Len;
+    if (Code < Min || Code > 0x10FFFF || (Code >= 0xD800 && Code <= 0xDFFF))
+        return PAINT_UTF8_INVALID; // Overlong, out of range or a surrogate
+    return Code;
+}
+
+/**
+ * Entry of a code point in the generated index, -1 if the font has no glyph for it
+ **/
+static int Paint_FindCodeCN(const cFONT *font, uint32_t Code)
+{
+    int Low = 0, High = font->index_size - 1, Mid;
+
+    while (Low <= High) {
+        Mid = (Low + High) / 2;
+        if (font->index[Mid].code < Code)
+            Low = Mid + 1;
+        else if (font->index[Mid].code > Code)
+            High = Mid - 1;
+        else
+            return Mid;
+    }
+    return -1;
+}
+
+/**
+ * Dot matrix of a code point in the CH_CN table, NULL if the font has no glyph for it.
+ * Binary search of the generated index, linear scan for fonts without one.
+ **/
+static const char *Paint_FindGlyphCN(const cFONT *font, uint32_t Code)
+{
+    int Num;
+
+    if (font->index != NULL) {
+        Num = Paint_FindCodeCN(font, Code);
+        return (Num < 0) ? NULL : font->table[font->index[Num].glyph].matrix;
+    }
+
+    for (Num = 0; Num < font->size; Num++) {
+        const char *Key = (const char *)font->table[Num].index;
+
+        if (Paint_Utf8Next(&Key) == Code)
+            return font->table[Num].matrix;
+    }
+    return NULL;
+}
+
+/**
+ * One packed glyph of Paint_DrawString_CN(): the ink box is read from the
+ * bitmap, the rest of the cell is background
+ **/
+static void Paint_DrawPackedCN(PAINT *Ctx, int x, int y, const CN_GLYPH *Glyph, const cFONT *font,
+                               UWORD Color_Foreground, UWORD Color_Background)
+{
+    const uint8_t *ptr    = &font->bitmap[Glyph->offset];
+    int            Stride = (Glyph->w + 7) / 8;
+    int            i, j, Col, Row;
+
+    if (FONT_BACKGROUND == Color_Background) { // Only the ink box
+        PAINT_PIXEL_FN Put = Paint_BlockWriter(Ctx, x + Glyph->x, y + Glyph->y, Glyph->w, Glyph->h);
+
+        for (j = 0; j < Glyph->h; j++) {
+            for (i = 0; i < Glyph->w; i++) {
+                if (ptr[j * Stride + i / 8] & (0x80 >> (i % 8)))
+                    Put(Ctx, x + Glyph->x + i, y + Glyph->y + j, Color_Foreground);
+            }
+        }
+    } else { // The whole cell, in the order of the table glyphs
+        PAINT_PIXEL_FN Put = Paint_BlockWriter(Ctx, x, y, font->Width, font->Height);
+
+        for (j = 0; j < font->Height; j++) {
+            for (i = 0; i < font->Width; i++) {
+                Col = i - Glyph->x;
+                Row = j - Glyph->y;
+                if (Col >= 0 && Col < Glyph->w && Row >= 0 && Row < Glyph->h &&
+                    (ptr[Row * Stride + Col / 8] & (0x80 >> (Col % 8))))
+                    Put(Ctx, x + i, y + j, Color_Foreground);
+                else
+                    Put(Ctx, x + i, y + j, Color_Background);
+            }
+        }
+    }
+}
+
+/**
+ * One glyph of Paint_DrawString_CN()
+ **/
+static void Paint_DrawMatrixCN(PAINT *Ctx, int x, int y, const char *ptr, const cFONT *font, UWORD Color_Foreground,
+                               UWORD Color_Background)
+{
+    PAINT_PIXEL_FN Put = Paint_BlockWriter(Ctx, x, y, font->Width, font->Height);
+    int            i, j;
+
+    for (j = 0; j < font->Height; j++) {
+        for (i = 0; i < font->Width; i++) {
+            if (FONT_BACKGROUND == Color_Background) { // this process is to speed up the scan
+                if (*ptr & (0x80 >> (i % 8))) {
+                    Put(Ctx, x + i, y + j, Color_Foreground);
+                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                }
+            } else {
+                if (*ptr & (0x80 >> (i % 8))) {
+                    Put(Ctx, x + i, y + j, Color_Foreground);
+                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                } else {
+                    Put(Ctx, x + i, y + j, Color_Background);
+                    // Paint_DrawPoint(x + i, y + j, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
+                }
+            }
+            if (i % 8 == 7) {
+                ptr++;
+            }
+        }
+        if (font->Width % 8 != 0) {
+            ptr++;
+        }
+    }
 }
 
 /******************************************************************************
@@ -604,98 +1429,38 @@ parameter:
     Color_Foreground : Select the foreground color
     Color_Background : Select the background color
 ******************************************************************************/
-void Paint_DrawString_CN(UWORD Xstart, UWORD Ystart, const char *pString, cFONT *font, UWORD Color_Foreground,
-                         UWORD Color_Background)
+void Paint_Ctx_DrawString_CN(PAINT *Ctx, UWORD Xstart, UWORD Ystart, const char *pString, cFONT *font,
+                             UWORD Color_Foreground, UWORD Color_Background)
 {
     const char *p_text = pString;
-    int         x = Xstart, y = Ystart;
-    int         i, j, Num;
+    const char *ptr;
+    uint32_t    Code;
+    int         x = Xstart, y = Ystart, Num;
+    int         Xend = Xstart;
 
     /* Send the string character by character on EPD */
     while (*p_text != 0) {
-        if (((unsigned char)*p_text) <= 0x7F) { // ASCII (single-byte)
-            for (Num = 0; Num < font->size; Num++) {
-                if (*p_text == font->table[Num].index[0]) {
-                    const char *ptr = &font->table[Num].matrix[0];
-
-                    for (j = 0; j < font->Height; j++) {
-                        for (i = 0; i < font->Width; i++) {
-                            if (FONT_BACKGROUND == Color_Background) { // this process is to speed up the scan
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            } else {
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                } else {
-                                    Paint_SetPixel(x + i, y + j, Color_Background);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            }
-                            if (i % 8 == 7) {
-                                ptr++;
-                            }
-                        }
-                        if (font->Width % 8 != 0) {
-                            ptr++;
-                        }
-                    }
-                    break;
-                }
+        Code = Paint_Utf8Next(&p_text);
+        if (Code == PAINT_UTF8_INVALID) {
+            Debug("Paint_DrawString_CN skips a malformed UTF-8 sequence\r\n");
+            continue;
+        }
+        if (font->glyphs != NULL) {
+            Num = Paint_FindCodeCN(font, Code);
+            if (Num >= 0) {
+                Paint_DrawPackedCN(Ctx, x, y, &font->glyphs[Num], font, Color_Foreground, Color_Background);
             }
-            /* Point on the next character */
-            p_text += 1;
-            /* Decrement the column position by 16 */
-            x += font->ASCII_Width;
-        } else { // Chinese
-            // Debug("p_text bytes: %02X %02X %02X\n", (unsigned char)p_text[0], (unsigned char)p_text[1], (unsigned
-            // char)p_text[2]);
-            for (Num = 0; Num < font->size; Num++) {
-                // Debug("p_text bytes: %02X %02X %02X\n", (unsigned char)p_text[0], (unsigned char)p_text[1], (unsigned
-                // char)p_text[2]);
-                if (((unsigned char)p_text[0] == (unsigned char)font->table[Num].index[0]) &&
-                    ((unsigned char)*(p_text + 1) == (unsigned char)font->table[Num].index[1]) &&
-                    ((unsigned char)*(p_text + 2) == (unsigned char)font->table[Num].index[2])) {
-                    // Debug("font idx: %02X %02X %02X (Num=%d)\n", (unsigned int)(unsigned
-                    // char)font->table[Num].index[0], (unsigned int)(unsigned char)font->table[Num].index[1], (unsigned
-                    // int)(unsigned char)font->table[Num].index[2], Num);
-                    const char *ptr = &font->table[Num].matrix[0];
-
-                    for (j = 0; j < font->Height; j++) {
-                        for (i = 0; i < font->Width; i++) {
-                            if (FONT_BACKGROUND == Color_Background) { // this process is to speed up the scan
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            } else {
-                                if (*ptr & (0x80 >> (i % 8))) {
-                                    Paint_SetPixel(x + i, y + j, Color_Foreground);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Foreground, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                } else {
-                                    Paint_SetPixel(x + i, y + j, Color_Background);
-                                    // Paint_DrawPoint(x + i, y + j, Color_Background, DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                                }
-                            }
-                            if (i % 8 == 7) {
-                                ptr++;
-                            }
-                        }
-                        if (font->Width % 8 != 0) {
-                            ptr++;
-                        }
-                    }
-                    break;
-                }
+        } else {
+            ptr = Paint_FindGlyphCN(font, Code);
+            if (ptr != NULL) {
+                Paint_DrawMatrixCN(Ctx, x, y, ptr, font, Color_Foreground, Color_Background);
             }
-            /* Point on the next character */
-            p_text += 3;
-            /* Decrement the column position by 16 */
-            x += font->Width;
         }
+        Xend = x + font->Width; // Cells are drawn full width, also for ASCII
+        /* ASCII advances by its own width, Chinese by the full cell */
+        x += (Code <= 0x7F) ? font->ASCII_Width : font->Width;
     }
+    Paint_Dirty(Ctx, Xstart, Ystart, Xend, Ystart + font->Height);
 }
 
 /******************************************************************************
@@ -709,15 +1474,15 @@ parameter:
     Color_Background : Select the background color
 ******************************************************************************/
 #define ARRAY_LEN 255
-void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, int32_t Nummber, sFONT *Font, UWORD Color_Foreground,
-                   UWORD Color_Background)
+void Paint_Ctx_DrawNum(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, int32_t Nummber, sFONT *Font, UWORD Color_Foreground,
+                       UWORD Color_Background)
 {
 
     int16_t  Num_Bit = 0, Str_Bit = 0;
     uint8_t  Str_Array[ARRAY_LEN] = {0}, Num_Array[ARRAY_LEN] = {0};
     uint8_t *pStr = Str_Array;
 
-    if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
+    if (Xpoint > Ctx->Width || Ypoint > Ctx->Height) {
         Debug("Paint_DisNum Input exceeds the normal display range\r\n");
         return;
     }
@@ -737,7 +1502,7 @@ void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, int32_t Nummber, sFONT *Font, UWO
     }
 
     // show
-    Paint_DrawString_EN(Xpoint, Ypoint, (const char *)pStr, Font, Color_Background, Color_Foreground);
+    Paint_Ctx_DrawString_EN(Ctx, Xpoint, Ypoint, (const char *)pStr, Font, Color_Background, Color_Foreground);
 }
 
 /******************************************************************************
@@ -750,22 +1515,25 @@ parameter:
     Color_Foreground : Select the foreground color
     Color_Background : Select the background color
 ******************************************************************************/
-void Paint_DrawTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT *Font, UWORD Color_Foreground,
-                    UWORD Color_Background)
+void Paint_Ctx_DrawTime(PAINT *Ctx, UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT *Font,
+                        UWORD Color_Foreground, UWORD Color_Background)
 {
     uint8_t value[10] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9'};
 
     UWORD Dx = Font->Width;
 
     // Write data into the cache
-    Paint_DrawChar(Xstart, Ystart, value[pTime->Hour / 10], Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx, Ystart, value[pTime->Hour % 10], Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx + Dx / 4 + Dx / 2, Ystart, ':', Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 2 + Dx / 2, Ystart, value[pTime->Min / 10], Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 3 + Dx / 2, Ystart, value[pTime->Min % 10], Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 4 + Dx / 2 - Dx / 4, Ystart, ':', Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 5, Ystart, value[pTime->Sec / 10], Font, Color_Background, Color_Foreground);
-    Paint_DrawChar(Xstart + Dx * 6, Ystart, value[pTime->Sec % 10], Font, Color_Background, Color_Foreground);
+    Paint_CharCell(Ctx, Xstart, Ystart, value[pTime->Hour / 10], Font, Color_Background, Color_Foreground);
+    Paint_CharCell(Ctx, Xstart + Dx, Ystart, value[pTime->Hour % 10], Font, Color_Background, Color_Foreground);
+    Paint_CharCell(Ctx, Xstart + Dx + Dx / 4 + Dx / 2, Ystart, ':', Font, Color_Background, Color_Foreground);
+    Paint_CharCell(Ctx, Xstart + Dx * 2 + Dx / 2, Ystart, value[pTime->Min / 10], Font, Color_Background,
+                   Color_Foreground);
+    Paint_CharCell(Ctx, Xstart + Dx * 3 + Dx / 2, Ystart, value[pTime->Min % 10], Font, Color_Background,
+                   Color_Foreground);
+    Paint_CharCell(Ctx, Xstart + Dx * 4 + Dx / 2 - Dx / 4, Ystart, ':', Font, Color_Background, Color_Foreground);
+    Paint_CharCell(Ctx, Xstart + Dx * 5, Ystart, value[pTime->Sec / 10], Font, Color_Background, Color_Foreground);
+    Paint_CharCell(Ctx, Xstart + Dx * 6, Ystart, value[pTime->Sec % 10], Font, Color_Background, Color_Foreground);
+    Paint_Dirty(Ctx, Xstart, Ystart, Xstart + Dx * 7, Ystart + Font->Height);
 }
 
 /******************************************************************************
@@ -776,15 +1544,16 @@ info:
     Use a computer to convert the image into a corresponding array,
     and then embed the array directly into Imagedata.cpp as a .c file.
 ******************************************************************************/
-void Paint_DrawBitMap(const unsigned char *image_buffer)
+void Paint_Ctx_DrawBitMap(PAINT *Ctx, const unsigned char *image_buffer)
 {
     UWORD   x, y;
     UDOUBLE Addr = 0;
 
-    for (y = 0; y < Paint.HeightByte; y++) {
-        for (x = 0; x < Paint.WidthByte; x++) { // 8 pixel =  1 byte
-            Addr              = x + y * Paint.WidthByte;
-            Paint.Image[Addr] = (unsigned char)image_buffer[Addr];
+    Paint_DirtyAll(Ctx);
+    for (y = 0; y < Ctx->HeightByte; y++) {
+        for (x = 0; x < Ctx->WidthByte; x++) { // 8 pixel =  1 byte
+            Addr              = x + y * Ctx->WidthByte;
+            Ctx->Image[Addr] = (unsigned char)image_buffer[Addr];
         }
     }
 }
@@ -798,17 +1567,223 @@ parameter:
     xEnd             ：Image width
     yEnd             : Image height
 ******************************************************************************/
-void Paint_DrawImage(const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image)
+void Paint_Ctx_DrawImage(PAINT *Ctx, const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image,
+                         UWORD H_Image)
 {
     UWORD   x, y;
     UWORD   w_byte = (W_Image % 8) ? (W_Image / 8) + 1 : W_Image / 8;
     UDOUBLE Addr   = 0;
     UDOUBLE pAddr  = 0;
+
+    // Bytes are copied as they are, whatever the rotation: mark the memory columns they cover
+    if (Ctx->Bits != 0 && yStart < Ctx->HeightMemory && (UDOUBLE)xStart / 8 * (8 / Ctx->Bits) < Ctx->WidthMemory &&
+        W_Image != 0 && H_Image != 0) {
+        UDOUBLE X1 = ((UDOUBLE)xStart / 8 + w_byte) * (8 / Ctx->Bits);
+        UDOUBLE Y1 = (UDOUBLE)yStart + H_Image;
+
+        Paint_DirtyAdd(Ctx, xStart / 8 * (8 / Ctx->Bits), yStart, X1 < Ctx->WidthMemory ? X1 : Ctx->WidthMemory,
+                       Y1 < Ctx->HeightMemory ? Y1 : Ctx->HeightMemory);
+    }
     for (y = 0; y < H_Image; y++) {
         for (x = 0; x < w_byte; x++) { // 8 pixel =  1 byte
             Addr               = x + y * w_byte;
-            pAddr              = x + (xStart / 8) + ((y + yStart) * Paint.WidthByte);
-            Paint.Image[pAddr] = (unsigned char)image_buffer[Addr];
+            pAddr              = x + (xStart / 8) + ((y + yStart) * Ctx->WidthByte);
+            Ctx->Image[pAddr] = (unsigned char)image_buffer[Addr];
         }
     }
 }
+
+/******************************************************************************
+function:	Record an area changed outside the Paint_Ctx_*() primitives
+parameter:
+    Xstart : x starting point
+    Ystart : Y starting point
+    Xend   : x end point, exclusive
+    Yend   : y end point, exclusive
+info:
+    For pixels written with Paint_Ctx_SetPixelFast() or straight into
+    Image; the area is clipped to the image.
+******************************************************************************/
+void Paint_Ctx_MarkDirty(PAINT *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    Paint_Dirty(Ctx, Xstart, Ystart, Xend, Yend);
+}
+
+/******************************************************************************
+function:	Areas of Image changed since the last Paint_Ctx_ResetDirty()
+parameter:
+    Rects : Set to the rectangles, valid until the next drawing call
+info:
+    Memory coordinates: row Y of a rectangle is Image + Y * WidthByte, and
+    its columns cover bytes X0 * Bits / 8 to (X1 * Bits + 7) / 8. The
+    rectangles do not overlap and together cover every changed pixel,
+    possibly with some unchanged ones. Returns how many there are, 0 when
+    nothing changed.
+******************************************************************************/
+UWORD Paint_Ctx_GetDirty(PAINT *Ctx, const PAINT_RECT **Rects)
+{
+    *Rects = Ctx->Dirty;
+    return Ctx->DirtyCount;
+}
+
+/******************************************************************************
+function:	Rows of Image changed since the last Paint_Ctx_ResetDirty()
+parameter:
+    Ystart : Set to the first changed memory row
+    Yend   : Set to the row after the last changed one
+info:
+    For consumers that work on whole rows, such as a frame checksum or an
+    upload. Returns 0 when nothing changed.
+******************************************************************************/
+UBYTE Paint_Ctx_GetDirtyRows(PAINT *Ctx, UWORD *Ystart, UWORD *Yend)
+{
+    UWORD i;
+
+    if (Ctx->DirtyCount == 0)
+        return 0;
+    *Ystart = Ctx->Dirty[0].Y0;
+    *Yend   = Ctx->Dirty[0].Y1;
+    for (i = 1; i < Ctx->DirtyCount; i++) {
+        if (Ctx->Dirty[i].Y0 < *Ystart)
+            *Ystart = Ctx->Dirty[i].Y0;
+        if (Ctx->Dirty[i].Y1 > *Yend)
+            *Yend = Ctx->Dirty[i].Y1;
+    }
+    return 1;
+}
+
+/******************************************************************************
+function:	Forget the changed areas, once Image has been flushed
+******************************************************************************/
+void Paint_Ctx_ResetDirty(PAINT *Ctx)
+{
+    Ctx->DirtyCount = 0;
+    memset(&Ctx->DirtyHint, 0, sizeof(Ctx->DirtyHint));
+}
+
+/******************************************************************************
+ * Default-context API on Paint, kept for existing callers
+******************************************************************************/
+void Paint_NewImage(UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color)
+{
+    Paint_Ctx_NewImage(&Paint, image, Width, Height, Rotate, Color);
+    Paint.Glyphs = &Paint_Glyphs; // Glyphs do not depend on the image, keep them
+}
+
+void Paint_SelectImage(UBYTE *image)
+{
+    Paint_Ctx_SelectImage(&Paint, image);
+}
+
+void Paint_SetRotate(UWORD Rotate)
+{
+    Paint_Ctx_SetRotate(&Paint, Rotate);
+}
+
+void Paint_SetMirroring(UBYTE mirror)
+{
+    Paint_Ctx_SetMirroring(&Paint, mirror);
+}
+
+void Paint_SetScale(UBYTE scale)
+{
+    Paint_Ctx_SetScale(&Paint, scale);
+}
+
+void Paint_SetPixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
+{
+    Paint_Ctx_SetPixel(&Paint, Xpoint, Ypoint, Color);
+}
+
+void Paint_Clear(UWORD Color)
+{
+    Paint_Ctx_Clear(&Paint, Color);
+}
+
+void Paint_ClearWindows(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color)
+{
+    Paint_Ctx_ClearWindows(&Paint, Xstart, Ystart, Xend, Yend, Color);
+}
+
+void Paint_DrawPoint(UWORD Xpoint, UWORD Ypoint, UWORD Color, DOT_PIXEL Dot_Pixel, DOT_STYLE Dot_Style)
+{
+    Paint_Ctx_DrawPoint(&Paint, Xpoint, Ypoint, Color, Dot_Pixel, Dot_Style);
+}
+
+void Paint_DrawLine(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width,
+                    LINE_STYLE Line_Style)
+{
+    Paint_Ctx_DrawLine(&Paint, Xstart, Ystart, Xend, Yend, Color, Line_width, Line_Style);
+}
+
+void Paint_DrawRectangle(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color, DOT_PIXEL Line_width,
+                         DRAW_FILL Draw_Fill)
+{
+    Paint_Ctx_DrawRectangle(&Paint, Xstart, Ystart, Xend, Yend, Color, Line_width, Draw_Fill);
+}
+
+void Paint_DrawCircle(UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Color, DOT_PIXEL Line_width,
+                      DRAW_FILL Draw_Fill)
+{
+    Paint_Ctx_DrawCircle(&Paint, X_Center, Y_Center, Radius, Color, Line_width, Draw_Fill);
+}
+
+void Paint_DrawChar(UWORD Xpoint, UWORD Ypoint, const char Acsii_Char, sFONT *Font, UWORD Color_Foreground,
+                    UWORD Color_Background)
+{
+    Paint_Ctx_DrawChar(&Paint, Xpoint, Ypoint, Acsii_Char, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char *pString, sFONT *Font, UWORD Color_Foreground,
+                         UWORD Color_Background)
+{
+    Paint_Ctx_DrawString_EN(&Paint, Xstart, Ystart, pString, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawString_CN(UWORD Xstart, UWORD Ystart, const char *pString, cFONT *font, UWORD Color_Foreground,
+                         UWORD Color_Background)
+{
+    Paint_Ctx_DrawString_CN(&Paint, Xstart, Ystart, pString, font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, int32_t Nummber, sFONT *Font, UWORD Color_Foreground,
+                   UWORD Color_Background)
+{
+    Paint_Ctx_DrawNum(&Paint, Xpoint, Ypoint, Nummber, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT *Font, UWORD Color_Foreground,
+                    UWORD Color_Background)
+{
+    Paint_Ctx_DrawTime(&Paint, Xstart, Ystart, pTime, Font, Color_Foreground, Color_Background);
+}
+
+void Paint_DrawBitMap(const unsigned char *image_buffer)
+{
+    Paint_Ctx_DrawBitMap(&Paint, image_buffer);
+}
+
+void Paint_DrawImage(const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image)
+{
+    Paint_Ctx_DrawImage(&Paint, image_buffer, xStart, yStart, W_Image, H_Image);
+}
+
+void Paint_MarkDirty(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend)
+{
+    Paint_Ctx_MarkDirty(&Paint, Xstart, Ystart, Xend, Yend);
+}
+
+UWORD Paint_GetDirty(const PAINT_RECT **Rects)
+{
+    return Paint_Ctx_GetDirty(&Paint, Rects);
+}
+
+UBYTE Paint_GetDirtyRows(UWORD *Ystart, UWORD *Yend)
+{
+    return Paint_Ctx_GetDirtyRows(&Paint, Ystart, Yend);
+}
+
+void Paint_ResetDirty(void)
+{
+    Paint_Ctx_ResetDirty(&Paint);
+}
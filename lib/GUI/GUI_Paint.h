@@ -73,10 +73,85 @@
 #include "DEV_Config.h"
 #include "../Fonts/fonts.h"
 
+struct _PAINT;
+
+/**
+ * Pixel writer bound to the current rotate, mirror and scale.
+ * No range check: Xpoint < WidthClip and Ypoint < HeightClip.
+ **/
+typedef void (*PAINT_PIXEL_FN)(struct _PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, UWORD Color);
+
+/**
+ * Glyph cache of Paint_DrawChar() on 4bpp canvases
+ **/
+#ifndef PAINT_GLYPH_SLOTS
+#define PAINT_GLYPH_SLOTS 32
+#endif
+#define PAINT_GLYPH_MAX_W     24 // Larger fonts take the per-pixel path
+#define PAINT_GLYPH_MAX_H     24
+#define PAINT_GLYPH_ROW_BYTES ((PAINT_GLYPH_MAX_W + 2) / 2)
+
 /**
- * Image attributes
+ * One glyph expanded into 4bpp nibble rows, starting at nibble Phase of the
+ * first byte. Mask has 0xF on every nibble the glyph writes.
  **/
 typedef struct {
+    const sFONT *Font; // NULL: free slot
+    char         Char;
+    UBYTE        Foreground;
+    UWORD        Background; // FONT_BACKGROUND: transparent
+    UBYTE        Phase;      // Memory x of the first column & 1
+    UBYTE        FlipX;      // Columns stored right to left
+    UBYTE        RowBytes;
+    UDOUBLE      Used;       // LRU stamp
+    UBYTE        Pixels[PAINT_GLYPH_MAX_H * PAINT_GLYPH_ROW_BYTES];
+    UBYTE        Mask[PAINT_GLYPH_MAX_H * PAINT_GLYPH_ROW_BYTES];
+} PAINT_GLYPH;
+
+typedef struct {
+    PAINT_GLYPH Slot[PAINT_GLYPH_SLOTS];
+    UDOUBLE     Clock;
+    UDOUBLE     Hits;
+    UDOUBLE     Misses;
+    UDOUBLE     Generation; // Font_Generation the slots were expanded under
+} PAINT_GLYPH_CACHE;
+
+/**
+ * Characters of packed sFONTs decoded back to the table layout; larger cells
+ * are not drawn
+ **/
+#ifndef PAINT_FONT_SLOTS
+#define PAINT_FONT_SLOTS 8
+#endif
+#define PAINT_FONT_BYTES (PAINT_GLYPH_MAX_H * ((PAINT_GLYPH_MAX_W + 7) / 8))
+
+typedef struct {
+    const sFONT *Font; // NULL: free slot
+    char         Char;
+    UDOUBLE      Used; // LRU stamp
+    UBYTE        Bits[PAINT_FONT_BYTES];
+} PAINT_FONT_SLOT;
+
+/**
+ * Area of Image changed by drawing, in memory pixels: columns [X0, X1) and
+ * rows [Y0, Y1) as stored, rotation and mirroring already applied
+ **/
+#ifndef PAINT_DIRTY_RECTS
+#define PAINT_DIRTY_RECTS 8
+#endif
+
+typedef struct {
+    UWORD X0;
+    UWORD Y0;
+    UWORD X1; // Exclusive
+    UWORD Y1; // Exclusive
+} PAINT_RECT;
+
+/**
+ * Image attributes, one per canvas.
+ * Each context may be drawn from its own thread, calls on one context must not overlap.
+ **/
+typedef struct _PAINT {
     UBYTE *Image;
     UWORD  Width;
     UWORD  Height;
@@ -88,8 +163,30 @@ typedef struct {
     UWORD  WidthByte;
     UWORD  HeightByte;
     UWORD  Scale;
+
+    PAINT_PIXEL_FN SetPixel;   // Set by Paint_Ctx_NewImage/SetRotate/SetMirroring/SetScale
+    UWORD          WidthClip;  // Logical area SetPixel may write
+    UWORD          HeightClip;
+    UWORD          Map;        // Logical to memory axes of SetPixel, see Paint_Bind()
+    UWORD          Bits;       // Bits per pixel of SetPixel, 0: draws nothing
+
+    PAINT_GLYPH_CACHE *Glyphs; // NULL: no glyph cache, see Paint_Ctx_SetGlyphCache()
+
+    // Packed sFONT characters, emptied by Paint_Ctx_NewImage() and when Font_Generation moves
+    PAINT_FONT_SLOT Decoded[PAINT_FONT_SLOTS];
+    UDOUBLE         DecodeClock;
+    UDOUBLE         DecodeGeneration;
+
+    // Changed since Paint_Ctx_ResetDirty(), touching areas merged; see Paint_Ctx_GetDirty()
+    PAINT_RECT Dirty[PAINT_DIRTY_RECTS];
+    UWORD      DirtyCount;
+    PAINT_RECT DirtyHint; // Logical area known to be inside Dirty, spares Paint_Ctx_SetPixel() the search
 } PAINT;
-extern PAINT Paint;
+extern PAINT Paint; // Default context of the Paint_*() calls
+
+// Unchecked pixel write for primitives that have clipped already, not recorded as dirty
+#define Paint_Ctx_SetPixelFast(Ctx, Xpoint, Ypoint, Color) (Ctx)->SetPixel((Ctx), (Xpoint), (Ypoint), (Color))
+#define Paint_SetPixelFast(Xpoint, Ypoint, Color)          Paint_Ctx_SetPixelFast(&Paint, Xpoint, Ypoint, Color)
 
 /**
  * Display rotate
@@ -216,5 +313,53 @@ void Paint_DrawTime(UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT *Font,
 
 // pic
 void Paint_DrawBitMap(const unsigned char *image_buffer);
+void Paint_DrawImage(const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image);
+
+// Changed areas
+void  Paint_MarkDirty(UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+UWORD Paint_GetDirty(const PAINT_RECT **Rects);
+UBYTE Paint_GetDirtyRows(UWORD *Ystart, UWORD *Yend);
+void  Paint_ResetDirty(void);
+
+// Per-context API; the calls above draw on Paint
+void Paint_Ctx_NewImage(PAINT *Ctx, UBYTE *image, UWORD Width, UWORD Height, UWORD Rotate, UWORD Color);
+void Paint_Ctx_SelectImage(PAINT *Ctx, UBYTE *image);
+void Paint_Ctx_SetRotate(PAINT *Ctx, UWORD Rotate);
+void Paint_Ctx_SetMirroring(PAINT *Ctx, UBYTE mirror);
+void Paint_Ctx_SetPixel(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, UWORD Color);
+void Paint_Ctx_SetScale(PAINT *Ctx, UBYTE scale);
+void Paint_Ctx_SetGlyphCache(PAINT *Ctx, PAINT_GLYPH_CACHE *Cache);
+
+void Paint_Ctx_Clear(PAINT *Ctx, UWORD Color);
+void Paint_Ctx_ClearWindows(PAINT *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color);
+
+void Paint_Ctx_DrawPoint(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, UWORD Color, DOT_PIXEL Dot_Pixel,
+                         DOT_STYLE Dot_FillWay);
+void Paint_Ctx_DrawLine(PAINT *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color,
+                        DOT_PIXEL Line_width, LINE_STYLE Line_Style);
+void Paint_Ctx_DrawRectangle(PAINT *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend, UWORD Color,
+                             DOT_PIXEL Line_width, DRAW_FILL Draw_Fill);
+void Paint_Ctx_DrawCircle(PAINT *Ctx, UWORD X_Center, UWORD Y_Center, UWORD Radius, UWORD Color, DOT_PIXEL Line_width,
+                          DRAW_FILL Draw_Fill);
+
+void Paint_Ctx_DrawChar(PAINT *Ctx, UWORD Xstart, UWORD Ystart, const char Acsii_Char, sFONT *Font,
+                        UWORD Color_Foreground, UWORD Color_Background);
+void Paint_Ctx_DrawString_EN(PAINT *Ctx, UWORD Xstart, UWORD Ystart, const char *pString, sFONT *Font,
+                             UWORD Color_Foreground, UWORD Color_Background);
+void Paint_Ctx_DrawString_CN(PAINT *Ctx, UWORD Xstart, UWORD Ystart, const char *pString, cFONT *font,
+                             UWORD Color_Foreground, UWORD Color_Background);
+void Paint_Ctx_DrawNum(PAINT *Ctx, UWORD Xpoint, UWORD Ypoint, int32_t Nummber, sFONT *Font, UWORD Color_Foreground,
+                       UWORD Color_Background);
+void Paint_Ctx_DrawTime(PAINT *Ctx, UWORD Xstart, UWORD Ystart, PAINT_TIME *pTime, sFONT *Font,
+                        UWORD Color_Foreground, UWORD Color_Background);
+
+void Paint_Ctx_DrawBitMap(PAINT *Ctx, const unsigned char *image_buffer);
+void Paint_Ctx_DrawImage(PAINT *Ctx, const unsigned char *image_buffer, UWORD xStart, UWORD yStart, UWORD W_Image,
+                         UWORD H_Image);
+
+void  Paint_Ctx_MarkDirty(PAINT *Ctx, UWORD Xstart, UWORD Ystart, UWORD Xend, UWORD Yend);
+UWORD Paint_Ctx_GetDirty(PAINT *Ctx, const PAINT_RECT **Rects);
+UBYTE Paint_Ctx_GetDirtyRows(PAINT *Ctx, UWORD *Ystart, UWORD *Yend);
+void  Paint_Ctx_ResetDirty(PAINT *Ctx);
 
 #endif
@@ -30,344 +30,1736 @@
 ******************************************************************************/
 #include "EPD_4in0e.h"
 #include "Debug.h"
+#include <string.h>
+
+// One frame: 2 pixels per byte
+#define EPD_4IN0E_WIDTH_BYTE(Dev)  (((UDOUBLE)(Dev)->Width + 1) / 2)
+#define EPD_4IN0E_FRAME_BYTES(Dev) (EPD_4IN0E_WIDTH_BYTE(Dev) * (Dev)->Height)
+
+/**
+ * Asynchronous refresh state machine
+ **/
+typedef enum {
+    EPD_4IN0E_ASYNC_IDLE = 0,
+    EPD_4IN0E_ASYNC_POWER_ON,      // 0x04 sent, waiting for BUSY
+    EPD_4IN0E_ASYNC_SECOND_SET,    // power is up, send the 0x06 setting
+    EPD_4IN0E_ASYNC_START_REFRESH, // send 0x12
+    EPD_4IN0E_ASYNC_REFRESH,       // 0x12 sent, waiting for BUSY
+    EPD_4IN0E_ASYNC_START_OFF,     // send 0x02
+    EPD_4IN0E_ASYNC_POWER_OFF,     // 0x02 sent, waiting for BUSY
+    EPD_4IN0E_ASYNC_FINISH,        // report completion
+} EPD_4IN0E_ASYNC_STATE;
+
+/**
+ * Device behind the EPD_4IN0E_* calls without a handle
+ **/
+static EPD_4IN0E_DEVICE EPD_4IN0E_DefaultDev;
+
+/**
+ * Register sequences: one record per command, sent with its parameters in a
+ * single CS-low transaction. Wait says what has to happen before the next one.
+ **/
+#define EPD_4IN0E_REG_MAX    6    // Longest parameter list (CMDH)
+#define EPD_4IN0E_SEQ_NONE   0xFF // Next command may follow immediately
+#define EPD_4IN0E_SEQ_SETTLE 0xFE // Fixed EPD_4IN0E_SETTLE_MS delay
+                                  // Anything else: EPD_4IN0E_BUSY_PHASE to wait for
+
+typedef struct {
+    UBYTE Cmd;
+    UBYTE Len;
+    UBYTE Wait;
+    UBYTE Data[EPD_4IN0E_REG_MAX];
+} EPD_4IN0E_REG;
+
+#define EPD_4IN0E_SEQ_LEN(Seq) (sizeof(Seq) / sizeof((Seq)[0]))
+
+static const EPD_4IN0E_REG EPD_4IN0E_InitSeq[] = {
+    {0xAA, 6, EPD_4IN0E_SEQ_NONE, {0x49, 0x55, 0x20, 0x08, 0x09, 0x18}}, // CMDH
+    {0x01, 1, EPD_4IN0E_SEQ_NONE, {0x3F}},
+    {0x00, 2, EPD_4IN0E_SEQ_NONE, {0x5F, 0x69}},
+    {0x05, 4, EPD_4IN0E_SEQ_NONE, {0x40, 0x1F, 0x1F, 0x2C}},
+    {0x08, 4, EPD_4IN0E_SEQ_NONE, {0x6F, 0x1F, 0x1F, 0x22}},
+    {0x06, 4, EPD_4IN0E_SEQ_NONE, {0x6F, 0x1F, 0x17, 0x17}},
+    {0x03, 4, EPD_4IN0E_SEQ_NONE, {0x00, 0x54, 0x00, 0x44}},
+    {0x60, 2, EPD_4IN0E_SEQ_NONE, {0x02, 0x00}},
+    {0x30, 1, EPD_4IN0E_SEQ_NONE, {0x08}},
+    {0x50, 1, EPD_4IN0E_SEQ_NONE, {0x3F}},
+    {0x61, 4, EPD_4IN0E_SEQ_NONE, {0x01, 0x90, 0x02, 0x58}}, // 400 x 600, replaced by Width x Height
+    {0xE3, 1, EPD_4IN0E_SEQ_NONE, {0x2F}},
+    {0x84, 1, EPD_4IN0E_SEQ_NONE, {0x01}},
+};
+
+// Steps of EPD_4IN0E_RefreshSeq, also driven one by one by the async refresh
+enum {
+    EPD_4IN0E_STEP_POWER_ON = 0,
+    EPD_4IN0E_STEP_SECOND_SET,
+    EPD_4IN0E_STEP_REFRESH,
+    EPD_4IN0E_STEP_POWER_OFF,
+};
+
+static const EPD_4IN0E_REG EPD_4IN0E_RefreshSeq[] = {
+    [EPD_4IN0E_STEP_POWER_ON]   = {0x04, 0, EPD_4IN0E_BUSY_POWER_ON, {0}},
+    [EPD_4IN0E_STEP_SECOND_SET] = {0x06, 4, EPD_4IN0E_SEQ_SETTLE, {0x6F, 0x1F, 0x17, 0x27}},
+    [EPD_4IN0E_STEP_REFRESH]    = {0x12, 1, EPD_4IN0E_BUSY_REFRESH, {0x00}},
+    [EPD_4IN0E_STEP_POWER_OFF]  = {0x02, 1, EPD_4IN0E_BUSY_POWER_OFF, {0x00}},
+};
+
+static const EPD_4IN0E_REG EPD_4IN0E_SleepReg = {0x07, 1, EPD_4IN0E_SEQ_NONE, {0xA5}}; // DEEP_SLEEP
+
+// Indices 0-5 in the order black, white, yellow, red, blue, green (server get_c)
+const UBYTE EPD_4IN0E_PALETTE_SEQUENTIAL[16] = {
+    EPD_4IN0E_BLACK, EPD_4IN0E_WHITE, EPD_4IN0E_YELLOW, EPD_4IN0E_RED,
+    EPD_4IN0E_BLUE,  EPD_4IN0E_GREEN, EPD_4IN0E_WHITE,  EPD_4IN0E_WHITE,
+    EPD_4IN0E_WHITE, EPD_4IN0E_WHITE, EPD_4IN0E_WHITE,  EPD_4IN0E_WHITE,
+    EPD_4IN0E_WHITE, EPD_4IN0E_WHITE, EPD_4IN0E_WHITE,  EPD_4IN0E_WHITE,
+};
+
+/**
+ * Busy-wait profiles: defaults until a phase has been measured
+ **/
+static const struct {
+    UDOUBLE Poll_ms;
+    UDOUBLE Timeout_ms;
+} EPD_4IN0E_BusyDefault[EPD_4IN0E_BUSY_PHASES] = {
+    [EPD_4IN0E_BUSY_RESET]     = {5, 2000},
+    [EPD_4IN0E_BUSY_INIT]      = {5, 2000},
+    [EPD_4IN0E_BUSY_POWER_ON]  = {5, 5000},
+    [EPD_4IN0E_BUSY_REFRESH]   = {100, 60000},
+    [EPD_4IN0E_BUSY_POWER_OFF] = {5, 5000},
+};
+
+/**
+ * SPI sweep: clocks tried by default, and the bands of the test frame;
+ * every byte holds two different colors so MOSI keeps toggling
+ **/
+static const UDOUBLE EPD_4IN0E_SweepFreqs[] = {
+    2000000, 4000000, 6000000, 8000000, 10000000, 13000000, 16000000, 20000000,
+};
+static const UBYTE EPD_4IN0E_SweepBands[] = {0x01, 0x23, 0x56, 0x10, 0x32, 0x65};
+
+/**
+ * Fingerprint of the frame on the panel, persisted in KV under the
+ * device's key; this one belongs to the default device
+ **/
+#define EPD_4IN0E_KV_FRAME  "epd_frame_sum"
+#define EPD_4IN0E_KV_SPI    "epd_spi_hz"
+#define EPD_4IN0E_HASH_SEED 2166136261u // FNV offset basis
 
 /******************************************************************************
 function :  Software reset
 parameter:
 ******************************************************************************/
-static void EPD_4IN0E_Reset(void)
+static void EPD_4IN0E_Reset(EPD_4IN0E_DEVICE *Dev)
 {
-    DEV_Digital_Write(EPD_RST_PIN, 1);
+    DEV_Digital_Write(Dev->Port->Rst, 1);
     DEV_Delay_ms(20);
-    DEV_Digital_Write(EPD_RST_PIN, 0);
+    DEV_Digital_Write(Dev->Port->Rst, 0);
     DEV_Delay_ms(2);
-    DEV_Digital_Write(EPD_RST_PIN, 1);
+    DEV_Digital_Write(Dev->Port->Rst, 1);
     DEV_Delay_ms(20);
 }
 
+/******************************************************************************
+function :  Reset pulse to leave deep sleep
+parameter:
+info:
+    RST is already high and the supply stable, so the leading 20 ms high
+    phase is skipped and the trailing one is left to the BUSY wait.
+******************************************************************************/
+static void EPD_4IN0E_WakeReset(EPD_4IN0E_DEVICE *Dev)
+{
+    DEV_Digital_Write(Dev->Port->Rst, 0);
+    DEV_Delay_ms(2);
+    DEV_Digital_Write(Dev->Port->Rst, 1);
+    DEV_Delay_ms(EPD_4IN0E_SETTLE_MS);
+}
+
 /******************************************************************************
 function :  send command
 parameter:
      Reg : Command register
 ******************************************************************************/
-static void EPD_4IN0E_SendCommand(UBYTE Reg)
+static void EPD_4IN0E_SendCommand(EPD_4IN0E_DEVICE *Dev, UBYTE Reg)
 {
-    DEV_Digital_Write(EPD_DC_PIN, 0);
-    DEV_Digital_Write(EPD_CS_PIN, 0);
-    DEV_SPI_WriteByte(Reg);
-    DEV_Digital_Write(EPD_CS_PIN, 1);
+    DEV_SPI_SEG Seg = {&Reg, 1};
+
+    DEV_Port_Writev(Dev->Port, &Seg, 1, DEV_SPI_DC_CMD);
 }
 
 /******************************************************************************
-function :  send data
+function :  send a command and its parameters
 parameter:
-    Data : Write data
+     Reg  : Command register
+     Data : Parameters, may be NULL when Len is 0
+     Len  : Number of parameters, at most EPD_4IN0E_REG_MAX
+info:
+    One CS-low transaction: DC drops for the command byte and rises for the
+    parameters, which go out in a single SPI call.
 ******************************************************************************/
-static void EPD_4IN0E_SendData(UBYTE Data)
+static void EPD_4IN0E_SendCommandData(EPD_4IN0E_DEVICE *Dev, UBYTE Reg, const UBYTE *Data, UBYTE Len)
 {
-    DEV_Digital_Write(EPD_DC_PIN, 1);
-    DEV_Digital_Write(EPD_CS_PIN, 0);
-    DEV_SPI_WriteByte(Data);
-    DEV_Digital_Write(EPD_CS_PIN, 1);
+    UBYTE       Buf[EPD_4IN0E_REG_MAX]; // Tables live in flash, the SPI wants RAM
+    DEV_SPI_SEG Seg[2] = {{&Reg, 1}, {Buf, 0}};
+
+    if (Len > EPD_4IN0E_REG_MAX) {
+        Len = EPD_4IN0E_REG_MAX;
+    }
+    if (Len > 0) {
+        memcpy(Buf, Data, Len);
+        Seg[1].Len = Len;
+    }
+    DEV_Port_Writev(Dev->Port, Seg, 2, DEV_SPI_DC_CMD);
 }
 
 /******************************************************************************
-function :  Wait until the busy_pin goes LOW
+function :  send one record of a register sequence
 parameter:
+     Reg : Command and parameters
 ******************************************************************************/
-static void EPD_4IN0E_ReadBusyH(void)
+static void EPD_4IN0E_SendReg(EPD_4IN0E_DEVICE *Dev, const EPD_4IN0E_REG *Reg)
 {
-    Debug("e-Paper busy H\r\n");
-    while (!DEV_Digital_Read(EPD_BUSY_PIN)) { // LOW: busy, HIGH: idle
-        DEV_Delay_ms(10);
+    if (Reg->Cmd == 0x61) { // TRES follows the device geometry
+        UBYTE Res[4] = {Dev->Width >> 8, Dev->Width & 0xFF, Dev->Height >> 8, Dev->Height & 0xFF};
+        EPD_4IN0E_SendCommandData(Dev, Reg->Cmd, Res, sizeof(Res));
+        return;
     }
-    DEV_Delay_ms(100);
-    Debug("e-Paper busy H release\r\n");
+    EPD_4IN0E_SendCommandData(Dev, Reg->Cmd, Reg->Data, Reg->Len);
 }
 
 /******************************************************************************
-function :  Turn On Display
+function :  Start a burst data transfer
 parameter:
+     Reg : Command register that the following data belongs to
+info:
+    DC and CS are asserted once here and held until EPD_4IN0E_EndData(),
+    so the data phase costs no GPIO toggles per byte.
 ******************************************************************************/
-static void EPD_4IN0E_TurnOnDisplay(void)
+static void EPD_4IN0E_BeginData(EPD_4IN0E_DEVICE *Dev, UBYTE Reg)
 {
+    EPD_4IN0E_SendCommand(Dev, Reg);
 
-    EPD_4IN0E_SendCommand(0x04); // POWER_ON
-    EPD_4IN0E_ReadBusyH();
-    DEV_Delay_ms(200);
+    // Whatever is loaded now has no fingerprint unless the caller sets one
+    Dev->PendingValid = 0;
 
-    // Second setting
-    EPD_4IN0E_SendCommand(0x06);
-    EPD_4IN0E_SendData(0x6F);
-    EPD_4IN0E_SendData(0x1F);
-    EPD_4IN0E_SendData(0x17);
-    EPD_4IN0E_SendData(0x27);
-    DEV_Delay_ms(200);
+    Dev->Transfer.Bytes  = 0;
+    Dev->Transfer.Bursts = 0;
+    Dev->TransferStart   = DEV_Get_ms();
 
-    EPD_4IN0E_SendCommand(0x12); // DISPLAY_REFRESH
-    EPD_4IN0E_SendData(0x00);
-    EPD_4IN0E_ReadBusyH();
+    DEV_Digital_Write(Dev->Port->Dc, 1);
+    DEV_Digital_Write(Dev->Port->Cs, 0);
+}
 
-    EPD_4IN0E_SendCommand(0x02); // POWER_OFF
-    EPD_4IN0E_SendData(0X00);
-    EPD_4IN0E_ReadBusyH();
+/******************************************************************************
+function :  Send a block of data inside a burst transfer
+parameter:
+    Data : Data to send
+    Len  : Number of bytes
+******************************************************************************/
+static void EPD_4IN0E_WriteData(EPD_4IN0E_DEVICE *Dev, const UBYTE *Data, UDOUBLE Len)
+{
+    while (Len > 0) {
+        // tkl_spi_send() takes a 16-bit length, never hand it a whole frame
+        UDOUBLE Burst = (Len > EPD_4IN0E_BURST_SIZE) ? EPD_4IN0E_BURST_SIZE : Len;
+        DEV_Port_Write_nByte(Dev->Port, (UBYTE *)Data, Burst);
+        Data += Burst;
+        Len -= Burst;
+        Dev->Transfer.Bytes += Burst;
+        Dev->Transfer.Bursts++;
+    }
 }
 
 /******************************************************************************
-function :  Initialize the e-Paper register
+function :  Send the same byte Len times inside a burst transfer
 parameter:
+    Data : Data to repeat
+    Len  : Number of bytes
 ******************************************************************************/
-void EPD_4IN0E_Init(void)
+static void EPD_4IN0E_FillData(EPD_4IN0E_DEVICE *Dev, UBYTE Data, UDOUBLE Len)
+{
+    memset(Dev->FillBuf, Data, (Len > sizeof(Dev->FillBuf)) ? sizeof(Dev->FillBuf) : Len);
+    while (Len > 0) {
+        UDOUBLE Burst = (Len > sizeof(Dev->FillBuf)) ? sizeof(Dev->FillBuf) : Len;
+        EPD_4IN0E_WriteData(Dev, Dev->FillBuf, Burst);
+        Len -= Burst;
+    }
+}
+
+/******************************************************************************
+function :  Stream Len bytes produced by Fill inside a burst transfer
+parameter:
+    Fill : Produces the next chunk while the previous one is on the wire
+    Arg  : Passed to Fill
+    Len  : Number of bytes
+******************************************************************************/
+static void EPD_4IN0E_StreamData(EPD_4IN0E_DEVICE *Dev, DEV_STREAM_FILL Fill, void *Arg, UDOUBLE Len)
 {
-    EPD_4IN0E_Reset();
-    EPD_4IN0E_ReadBusyH();
-    DEV_Delay_ms(30);
+    DEV_Stream_Init(&Dev->Stream, Dev->Port);
+    Dev->Transfer.Bytes += DEV_Stream_Run(&Dev->Stream, Fill, Arg, Len);
+    Dev->Transfer.Bursts += Dev->Stream.Stats.Chunks;
+}
 
-    EPD_4IN0E_SendCommand(0xAA); // CMDH
-    EPD_4IN0E_SendData(0x49);
-    EPD_4IN0E_SendData(0x55);
-    EPD_4IN0E_SendData(0x20);
-    EPD_4IN0E_SendData(0x08);
-    EPD_4IN0E_SendData(0x09);
-    EPD_4IN0E_SendData(0x18);
+/**
+ * Fill argument for uploading a frame buffer
+ **/
+typedef struct {
+    EPD_4IN0E_DEVICE *Dev;
+    const UBYTE      *Image;
+} EPD_4IN0E_IMAGE_SRC;
 
-    EPD_4IN0E_SendCommand(0x01);
-    EPD_4IN0E_SendData(0x3F);
+/**
+ * Fill callback: plain copy out of a frame buffer
+ **/
+static UDOUBLE EPD_4IN0E_CopyFill(UBYTE *Buf, UDOUBLE Size, UDOUBLE Offset, void *Arg)
+{
+    EPD_4IN0E_DEVICE *Dev = ((EPD_4IN0E_IMAGE_SRC *)Arg)->Dev;
+    const UBYTE      *Src = ((EPD_4IN0E_IMAGE_SRC *)Arg)->Image + Offset;
+    UDOUBLE           i;
 
-    EPD_4IN0E_SendCommand(0x00);
-    EPD_4IN0E_SendData(0x5F);
-    EPD_4IN0E_SendData(0x69);
+    if (!Dev->LutOn) {
+        memcpy(Buf, Src, Size);
+        return Size;
+    }
+    for (i = 0; i < Size; i++) {
+        Buf[i] = Dev->Lut[Src[i]];
+    }
+    return Size;
+}
 
-    EPD_4IN0E_SendCommand(0x05);
-    EPD_4IN0E_SendData(0x40);
-    EPD_4IN0E_SendData(0x1F);
-    EPD_4IN0E_SendData(0x1F);
-    EPD_4IN0E_SendData(0x2C);
+/******************************************************************************
+function :  Stream fill that reorients a frame buffer into panel scanlines
+parameter:
+    Arg : Source frame; panel-sized, or 600 x 400 when transposing
+return   :  Bytes produced, always whole panel rows
+info:
+    Transposed modes work on 2 x 2 pixel tiles: one byte from each of two
+    source rows gives one byte for each of two panel rows. For a column pair
+    the bytes of all rows in the chunk sit next to each other in the source,
+    so each chunk reads a narrow band of it instead of striding a full
+    300-byte source row per pixel. No second frame buffer is needed.
+******************************************************************************/
+static UDOUBLE EPD_4IN0E_OrientFill(UBYTE *Buf, UDOUBLE Size, UDOUBLE Offset, void *Arg)
+{
+    EPD_4IN0E_DEVICE *Dev  = ((EPD_4IN0E_IMAGE_SRC *)Arg)->Dev;
+    const UBYTE      *Src  = ((EPD_4IN0E_IMAGE_SRC *)Arg)->Image;
+    UWORD             Y0   = Offset / EPD_4IN0E_WIDTH_BYTE(Dev);
+    UWORD             Rows = Size / EPD_4IN0E_WIDTH_BYTE(Dev);
+    UWORD             r, x, i;
+    UBYTE            *Out;
 
-    EPD_4IN0E_SendCommand(0x08);
-    EPD_4IN0E_SendData(0x6F);
-    EPD_4IN0E_SendData(0x1F);
-    EPD_4IN0E_SendData(0x1F);
-    EPD_4IN0E_SendData(0x22);
+    if (!Dev->Orient.Transpose) {
+        for (r = 0; r < Rows; r++) {
+            UWORD        Sy     = Dev->Orient.FlipY ? Dev->Height - 1 - (Y0 + r) : Y0 + r;
+            const UBYTE *SrcRow = Src + (UDOUBLE)Sy * EPD_4IN0E_WIDTH_BYTE(Dev);
 
-    EPD_4IN0E_SendCommand(0x06);
-    EPD_4IN0E_SendData(0x6F);
-    EPD_4IN0E_SendData(0x1F);
-    EPD_4IN0E_SendData(0x17);
-    EPD_4IN0E_SendData(0x17);
+            Out = Buf + (UDOUBLE)r * EPD_4IN0E_WIDTH_BYTE(Dev);
+            if (!Dev->Orient.FlipX) {
+                memcpy(Out, SrcRow, EPD_4IN0E_WIDTH_BYTE(Dev));
+            } else {
+                // Reverse the byte order and swap the two pixels of each byte
+                for (i = 0; i < EPD_4IN0E_WIDTH_BYTE(Dev); i++) {
+                    UBYTE b = SrcRow[EPD_4IN0E_WIDTH_BYTE(Dev) - 1 - i];
+                    Out[i]  = (UBYTE)((b << 4) | (b >> 4));
+                }
+            }
+        }
+    } else {
+        // Source is Height wide and Width tall
+        const UDOUBLE SrcWB = Dev->Height / 2;
 
-    EPD_4IN0E_SendCommand(0x03);
-    EPD_4IN0E_SendData(0x00);
-    EPD_4IN0E_SendData(0x54);
-    EPD_4IN0E_SendData(0x00);
-    EPD_4IN0E_SendData(0x44);
+        Rows &= ~1; // Whole 2 x 2 tiles; Y0 is even as chunks hold whole row pairs
+        for (x = 0; x < Dev->Width; x += 2) {
+            UWORD        Sy0 = Dev->Orient.FlipY ? Dev->Width - 1 - x : x;
+            UWORD        Sy1 = Dev->Orient.FlipY ? Sy0 - 1 : Sy0 + 1;
+            const UBYTE *S0  = Src + (UDOUBLE)Sy0 * SrcWB;
+            const UBYTE *S1  = Src + (UDOUBLE)Sy1 * SrcWB;
 
-    EPD_4IN0E_SendCommand(0x60);
-    EPD_4IN0E_SendData(0x02);
-    EPD_4IN0E_SendData(0x00);
+            Out = Buf + x / 2;
+            for (r = 0; r < Rows; r += 2) {
+                UWORD Y  = Y0 + r;
+                UWORD K  = Dev->Orient.FlipX ? (Dev->Height - 1 - Y) / 2 : Y / 2;
+                UBYTE b0 = S0[K], b1 = S1[K];
 
-    EPD_4IN0E_SendCommand(0x30);
-    EPD_4IN0E_SendData(0x08);
+                if (Dev->Orient.FlipX) { // Row Y is the low pixel of the source byte
+                    b0 = (UBYTE)((b0 << 4) | (b0 >> 4));
+                    b1 = (UBYTE)((b1 << 4) | (b1 >> 4));
+                }
+                Out[(UDOUBLE)r * EPD_4IN0E_WIDTH_BYTE(Dev)]       = (b0 & 0xF0) | (b1 >> 4);
+                Out[(UDOUBLE)(r + 1) * EPD_4IN0E_WIDTH_BYTE(Dev)] = (UBYTE)(b0 << 4) | (b1 & 0x0F);
+            }
+        }
+    }
 
-    EPD_4IN0E_SendCommand(0x50);
-    EPD_4IN0E_SendData(0x3F);
+    Size = (UDOUBLE)Rows * EPD_4IN0E_WIDTH_BYTE(Dev);
+    if (Dev->LutOn) {
+        for (i = 0; i < Size; i++) {
+            Buf[i] = Dev->Lut[Buf[i]];
+        }
+    }
+    return Size;
+}
 
-    EPD_4IN0E_SendCommand(0x61);
-    EPD_4IN0E_SendData(0x01);
-    EPD_4IN0E_SendData(0x90);
-    EPD_4IN0E_SendData(0x02);
-    EPD_4IN0E_SendData(0x58);
+/******************************************************************************
+function :  Stream a frame buffer with the device's palette and orientation
+parameter:
+    Image : Frame buffer
+******************************************************************************/
+static void EPD_4IN0E_StreamImage(EPD_4IN0E_DEVICE *Dev, const UBYTE *Image)
+{
+    EPD_4IN0E_IMAGE_SRC Src = {Dev, Image};
 
-    EPD_4IN0E_SendCommand(0xE3);
-    EPD_4IN0E_SendData(0x2F);
+    EPD_4IN0E_StreamData(Dev, Dev->Orient.On ? EPD_4IN0E_OrientFill : EPD_4IN0E_CopyFill, &Src,
+                         EPD_4IN0E_FRAME_BYTES(Dev));
+}
 
-    EPD_4IN0E_SendCommand(0x84);
-    EPD_4IN0E_SendData(0x01);
-    EPD_4IN0E_ReadBusyH();
+/**
+ * Fingerprint seed: the same source under another palette or orientation
+ * is a different picture on the panel
+ **/
+static UDOUBLE EPD_4IN0E_HashSeed(EPD_4IN0E_DEVICE *Dev)
+{
+    return EPD_4IN0E_HASH_SEED ^ Dev->PaletteSum ^ Dev->Orient.Sum;
 }
 
 /******************************************************************************
-function :  Clear screen
+function :  Orientation of frame buffers passed to EPD_4IN0E_Display*
 parameter:
+    Rotate : EPD_4IN0E_ROTATE_0/90/180/270, clockwise as in Paint_SetRotate()
+    Mirror : EPD_4IN0E_MIRROR_*, applied after the rotation as in Paint
+return   :  0 ok; 1 invalid argument, orientation unchanged
+info:
+    With 90 or 270 the source is a 600 x 400 landscape frame. Streamed
+    frames (Display_Stream*) are not reoriented.
 ******************************************************************************/
-void EPD_4IN0E_Clear(UBYTE color)
+UBYTE EPD_4IN0E_Dev_SetOrientation(EPD_4IN0E_DEVICE *Dev, UWORD Rotate, UBYTE Mirror)
 {
-    UWORD Width, Height;
-    Width  = (EPD_4IN0E_WIDTH % 2 == 0) ? (EPD_4IN0E_WIDTH / 2) : (EPD_4IN0E_WIDTH / 2 + 1);
-    Height = EPD_4IN0E_HEIGHT;
+    UBYTE MirrorH = (Mirror & EPD_4IN0E_MIRROR_HORIZONTAL) ? 1 : 0;
+    UBYTE MirrorV = (Mirror & EPD_4IN0E_MIRROR_VERTICAL) ? 1 : 0;
 
-    EPD_4IN0E_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_4IN0E_SendData((color << 4) | color);
-        }
+    if (Mirror > EPD_4IN0E_MIRROR_ORIGIN) {
+        Debug("e-Paper orientation: bad mirror %d\r\n", Mirror);
+        return 1;
     }
-
-    EPD_4IN0E_TurnOnDisplay();
+    switch (Rotate) {
+    case EPD_4IN0E_ROTATE_0:
+        Dev->Orient.Transpose = 0;
+        Dev->Orient.FlipX     = MirrorH;
+        Dev->Orient.FlipY     = MirrorV;
+        break;
+    case EPD_4IN0E_ROTATE_90:
+        Dev->Orient.Transpose = 1;
+        Dev->Orient.FlipX     = MirrorV;
+        Dev->Orient.FlipY     = !MirrorH;
+        break;
+    case EPD_4IN0E_ROTATE_180:
+        Dev->Orient.Transpose = 0;
+        Dev->Orient.FlipX     = !MirrorH;
+        Dev->Orient.FlipY     = !MirrorV;
+        break;
+    case EPD_4IN0E_ROTATE_270:
+        Dev->Orient.Transpose = 1;
+        Dev->Orient.FlipX     = !MirrorV;
+        Dev->Orient.FlipY     = MirrorH;
+        break;
+    default:
+        Debug("e-Paper orientation: bad rotation %d\r\n", Rotate);
+        return 1;
+    }
+    Dev->Orient.On  = Dev->Orient.Transpose | Dev->Orient.FlipX | Dev->Orient.FlipY;
+    Dev->Orient.Sum =
+        Dev->Orient.On ? (Dev->Orient.Transpose << 2 | Dev->Orient.FlipX << 1 | Dev->Orient.FlipY) * 0x9E3779B1u : 0;
+    return 0;
 }
 
 /******************************************************************************
-function :  show 7 kind of color block
+function :  Select how source color indices map to panel colors
 parameter:
+    Map : 16 panel colors indexed by source nibble, e.g.
+          EPD_4IN0E_PALETTE_SEQUENTIAL; NULL sends the source unchanged
+info:
+    The map is expanded into a 256-entry byte table, so the remap costs one
+    lookup per byte inside the upload loop and no pass of its own.
 ******************************************************************************/
-void EPD_4IN0E_Show7Block(void)
+void EPD_4IN0E_Dev_SetPalette(EPD_4IN0E_DEVICE *Dev, const UBYTE *Map)
 {
-    unsigned long       j, k;
-    unsigned char const Color_seven[6] = {EPD_4IN0E_BLACK, EPD_4IN0E_YELLOW, EPD_4IN0E_RED,
-                                          EPD_4IN0E_BLUE,  EPD_4IN0E_GREEN,  EPD_4IN0E_WHITE};
+    UWORD i;
 
-    EPD_4IN0E_SendCommand(0x10);
-    for (k = 0; k < 6; k++) {
-        for (j = 0; j < 20000; j++) {
-            EPD_4IN0E_SendData((Color_seven[k] << 4) | Color_seven[k]);
+    Dev->LutOn      = 0;
+    Dev->PaletteSum = 0;
+    if (Map == NULL) {
+        return;
+    }
+    for (i = 0; i < 256; i++) {
+        Dev->Lut[i] = ((Map[i >> 4] & 0x0F) << 4) | (Map[i & 0x0F] & 0x0F);
+        if (Dev->Lut[i] != i) {
+            Dev->LutOn = 1;
+        }
+    }
+    if (Dev->LutOn) {
+        for (i = 0; i < 16; i++) {
+            Dev->PaletteSum = (Dev->PaletteSum ^ (Map[i] & 0x0F)) * 16777619u;
         }
+        Dev->PaletteSum |= 1; // Never 0 when a remap is active
     }
-    EPD_4IN0E_TurnOnDisplay();
 }
 
-void EPD_4IN0E_Show(void)
+/******************************************************************************
+function :  Finish a burst transfer and update the throughput statistics
+parameter:
+******************************************************************************/
+static void EPD_4IN0E_EndData(EPD_4IN0E_DEVICE *Dev)
 {
-    unsigned long       k, o;
-    unsigned char const Color_seven[6] = {EPD_4IN0E_BLACK, EPD_4IN0E_YELLOW, EPD_4IN0E_RED,
-                                          EPD_4IN0E_BLUE,  EPD_4IN0E_GREEN,  EPD_4IN0E_WHITE};
+    DEV_Digital_Write(Dev->Port->Cs, 1);
 
-    UWORD Width, Height;
-    Width  = (EPD_4IN0E_WIDTH % 2 == 0) ? (EPD_4IN0E_WIDTH / 2) : (EPD_4IN0E_WIDTH / 2 + 1);
-    Height = EPD_4IN0E_HEIGHT;
-    k      = 0;
-    o      = 0;
+    Dev->Transfer.Time_ms     = DEV_Get_ms() - Dev->TransferStart;
+    Dev->Transfer.BytesPerSec = Dev->Transfer.Time_ms
+                                         ? (UDOUBLE)((uint64_t)Dev->Transfer.Bytes * 1000 /
+                                                     Dev->Transfer.Time_ms)
+                                         : 0;
+    Debug("e-Paper transfer: %u bytes, %u bursts, %u ms, %u B/s\r\n", Dev->Transfer.Bytes,
+          Dev->Transfer.Bursts, Dev->Transfer.Time_ms, Dev->Transfer.BytesPerSec);
+}
 
-    EPD_4IN0E_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        if ((j > 10) && (j < 50))
-            for (UWORD i = 0; i < Width; i++) {
-                EPD_4IN0E_SendData((Color_seven[0] << 4) | Color_seven[0]);
-            }
-        else if (o < Height / 2)
-            for (UWORD i = 0; i < Width; i++) {
-                EPD_4IN0E_SendData((Color_seven[0] << 4) | Color_seven[0]);
-            }
+/******************************************************************************
+function :  Statistics of the last burst transfer
+parameter:
+    Stats : Receives bytes, bursts, duration and throughput
+******************************************************************************/
+void EPD_4IN0E_Dev_GetTransferStats(EPD_4IN0E_DEVICE *Dev, EPD_4IN0E_TRANSFER_STATS *Stats)
+{
+    *Stats = Dev->Transfer;
+}
 
-        else {
-            for (UWORD i = 0; i < Width; i++) {
-                EPD_4IN0E_SendData((Color_seven[k] << 4) | Color_seven[k]);
-            }
-            k++;
-            if (k >= 6)
-                k = 0;
+/**
+ * Running frame fingerprint; bytes of an unfinished word wait in Part
+ **/
+typedef struct {
+    UDOUBLE Sum;
+    UBYTE   Part[4];
+    UBYTE   Have;
+} EPD_4IN0E_HASH;
+
+/******************************************************************************
+function :  Feed bytes into a frame fingerprint
+parameter:
+    Hash : Running state, Sum = EPD_4IN0E_HashSeed() and Have = 0 to start
+    Data : Next bytes of the frame
+    Len  : Byte count, any size
+info:
+    FNV-1a over 32-bit words, a quarter of the rounds of the bytewise form.
+    A word split across two pieces is completed from the next one, so the
+    result does not depend on how the frame is chunked.
+******************************************************************************/
+static void EPD_4IN0E_HashUpdate(EPD_4IN0E_HASH *Hash, const UBYTE *Data, UDOUBLE Len)
+{
+    UDOUBLE Sum = Hash->Sum;
+    UDOUBLE Word, i = 0;
+
+    while (Hash->Have != 0 && i < Len) {
+        Hash->Part[Hash->Have++] = Data[i++];
+        if (Hash->Have == 4) {
+            memcpy(&Word, Hash->Part, 4);
+            Sum        = (Sum ^ Word) * 16777619u;
+            Hash->Have = 0;
         }
+    }
+    for (; i + 4 <= Len; i += 4) {
+        memcpy(&Word, Data + i, 4);
+        Sum = (Sum ^ Word) * 16777619u;
+    }
+    for (; i < Len; i++) {
+        Hash->Part[Hash->Have++] = Data[i];
+    }
+    Hash->Sum = Sum;
+}
 
-        o++;
-        if (o >= Height)
-            o = 0;
+/**
+ * Fingerprint once the whole frame is in: the last bytes go in one by one
+ **/
+static UDOUBLE EPD_4IN0E_HashFinish(const EPD_4IN0E_HASH *Hash)
+{
+    UDOUBLE Sum = Hash->Sum;
+    UBYTE   i;
+
+    for (i = 0; i < Hash->Have; i++) {
+        Sum = (Sum ^ Hash->Part[i]) * 16777619u;
     }
-    EPD_4IN0E_TurnOnDisplay();
+    return Sum;
 }
 
 /******************************************************************************
-function :  Sends the image buffer in RAM to e-Paper and displays
+function :  Fast fingerprint of a frame buffer
 parameter:
+    Image : Frame buffer, EPD_4IN0E_FRAME_BYTES(Dev) long
 ******************************************************************************/
-void EPD_4IN0E_Display(UBYTE *Image)
+UDOUBLE EPD_4IN0E_Dev_FrameChecksum(EPD_4IN0E_DEVICE *Dev, const UBYTE *Image)
 {
-    UWORD Width, Height;
-    Width  = (EPD_4IN0E_WIDTH % 2 == 0) ? (EPD_4IN0E_WIDTH / 2) : (EPD_4IN0E_WIDTH / 2 + 1);
-    Height = EPD_4IN0E_HEIGHT;
+    EPD_4IN0E_HASH Hash = {EPD_4IN0E_HashSeed(Dev), {0}, 0};
 
-    EPD_4IN0E_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_4IN0E_SendData(Image[i + j * Width]);
+    EPD_4IN0E_HashUpdate(&Hash, Image, EPD_4IN0E_FRAME_BYTES(Dev));
+    return EPD_4IN0E_HashFinish(&Hash);
+}
+
+
+/**
+ * Load the fingerprint of the frame on the panel, once per boot
+ **/
+static void EPD_4IN0E_LoadShown(EPD_4IN0E_DEVICE *Dev)
+{
+    UBYTE *Value = NULL;
+    size_t Len   = 0;
+
+    if (Dev->ShownState != 0) {
+        return;
+    }
+    Dev->ShownState = 2;
+    if (Dev->KvKey && tal_kv_get(Dev->KvKey, &Value, &Len) == OPRT_OK && Value != NULL) {
+        if (Len == sizeof(Dev->ShownSum)) {
+            memcpy(&Dev->ShownSum, Value, sizeof(Dev->ShownSum));
+            Dev->ShownState = 1;
         }
+        tal_kv_free(Value);
     }
-    EPD_4IN0E_TurnOnDisplay();
 }
 
 /**
- * Optimized version of ReadBusyH with reduced wait time
- * 原始ReadBusyH等待时间太长，这里提供优化版本
- */
-static void EPD_4IN0E_ReadBusyH_Optimized(void)
+ * Apply the clock of the last sweep, read from KV once per boot
+ **/
+static void EPD_4IN0E_LoadSpiFreq(EPD_4IN0E_DEVICE *Dev)
 {
-    Debug("e-Paper busy H\r\n");
-    UWORD timeout = 0;
-    // 优化：检查间隔从10ms减少到5ms
-    while (!DEV_Digital_Read(EPD_BUSY_PIN)) { // LOW: busy
-        DEV_Delay_ms(5);
-        timeout++;
-        // 优化：添加超时保护（1秒）
-        if (timeout > 200) {
-            Debug("e-Paper busy timeout\r\n");
-            break;
+    UBYTE *Value = NULL;
+    size_t Len   = 0;
+
+    if (Dev->SpiLoaded) {
+        return;
+    }
+    Dev->SpiLoaded = 1;
+    if (Dev->KvSpiKey && tal_kv_get(Dev->KvSpiKey, &Value, &Len) == OPRT_OK && Value != NULL) {
+        if (Len == sizeof(Dev->SpiHz)) {
+            memcpy(&Dev->SpiHz, Value, sizeof(Dev->SpiHz));
         }
+        tal_kv_free(Value);
+    }
+    if (Dev->SpiHz != 0) {
+        DEV_Port_SetFreq(Dev->Port, Dev->SpiHz);
     }
-    // 优化：等待时间从100ms减少到50ms
-    DEV_Delay_ms(50);
-    Debug("e-Paper busy H release\r\n");
 }
 
 /**
- * Optimized version of TurnOnDisplay with reduced wait time
- * 原始TurnOnDisplay等待时间太长，这里提供优化版本
- */
-static void EPD_4IN0E_TurnOnDisplay_Optimized(void)
+ * Called after a refresh: the pending frame is now the one on the panel
+ **/
+static void EPD_4IN0E_CommitShown(EPD_4IN0E_DEVICE *Dev)
+{
+    EPD_4IN0E_LoadShown(Dev);
+    if (Dev->PendingValid) {
+        if (Dev->ShownState == 1 && Dev->ShownSum == Dev->PendingSum) {
+            return;
+        }
+        Dev->ShownSum   = Dev->PendingSum;
+        Dev->ShownState = 1;
+        if (Dev->KvKey) {
+            tal_kv_set(Dev->KvKey, (const uint8_t *)&Dev->ShownSum, sizeof(Dev->ShownSum));
+        }
+    } else if (Dev->ShownState == 1) {
+        Dev->ShownState = 2;
+        if (Dev->KvKey) {
+            tal_kv_del(Dev->KvKey);
+        }
+    }
+}
+
+/******************************************************************************
+function :  Whether Image is already what the panel shows
+parameter:
+    Image : Frame buffer
+return   :  1 identical to the last displayed frame (also across reboots)
+info:
+    Needs no SPI or GPIO, so a caller can skip module init altogether.
+******************************************************************************/
+UBYTE EPD_4IN0E_Dev_IsFrameShown(EPD_4IN0E_DEVICE *Dev, const UBYTE *Image)
+{
+    EPD_4IN0E_LoadShown(Dev);
+    return Dev->ShownState == 1 && Dev->ShownSum == EPD_4IN0E_Dev_FrameChecksum(Dev, Image);
+}
+
+/**
+ * Whether the frame just loaded is already the one on the panel
+ **/
+static UBYTE EPD_4IN0E_PendingShown(EPD_4IN0E_DEVICE *Dev)
+{
+    EPD_4IN0E_LoadShown(Dev);
+    return Dev->PendingValid && Dev->ShownState == 1 && Dev->ShownSum == Dev->PendingSum;
+}
+
+/******************************************************************************
+function :  Busy-wait profile of a phase
+parameter:
+    Phase : Busy phase
+info:
+    Until a phase has been measured its defaults apply. Afterwards the
+    first poll is deferred to 3/4 of the shortest wait seen, polls come at
+    1/32 of the average, and the timeout is never below the default nor
+    below twice the longest wait seen, so a slow refresh is not cut short.
+    Waits that timed out are not recorded, and the learned timeout stops
+    at EPD_4IN0E_BUSY_TIMEOUT_CAP times the default.
+******************************************************************************/
+static UDOUBLE EPD_4IN0E_BusyLead(EPD_4IN0E_DEVICE *Dev, EPD_4IN0E_BUSY_PHASE Phase)
+{
+    const EPD_4IN0E_BUSY_STATS *St = &Dev->BusyStats[Phase];
+    return St->Count ? St->Min_ms * 3 / 4 : 0;
+}
+
+static UDOUBLE EPD_4IN0E_BusyPoll(EPD_4IN0E_DEVICE *Dev, EPD_4IN0E_BUSY_PHASE Phase)
+{
+    const EPD_4IN0E_BUSY_STATS *St = &Dev->BusyStats[Phase];
+    UDOUBLE                     Poll;
+
+    if (St->Count == 0) {
+        return EPD_4IN0E_BusyDefault[Phase].Poll_ms;
+    }
+    Poll = St->Avg_ms / 32;
+    if (Poll < EPD_4IN0E_BUSY_POLL_MIN_MS) {
+        Poll = EPD_4IN0E_BUSY_POLL_MIN_MS;
+    } else if (Poll > EPD_4IN0E_BUSY_POLL_MAX_MS) {
+        Poll = EPD_4IN0E_BUSY_POLL_MAX_MS;
+    }
+    return Poll;
+}
+
+static UDOUBLE EPD_4IN0E_BusyTimeout(EPD_4IN0E_DEVICE *Dev, EPD_4IN0E_BUSY_PHASE Phase)
+{
+    UDOUBLE Timeout = EPD_4IN0E_BusyDefault[Phase].Timeout_ms;
+    UDOUBLE Cap     = Timeout * EPD_4IN0E_BUSY_TIMEOUT_CAP;
+
+    if (Phase == EPD_4IN0E_BUSY_REFRESH && Dev->TempValid && Dev->Temp_C < EPD_4IN0E_TEMP_COLD_C) {
+        Timeout *= 2; // Cold waveforms run longer
+    }
+    if (Dev->BusyStats[Phase].Max_ms * 2 > Timeout) {
+        Timeout = Dev->BusyStats[Phase].Max_ms * 2;
+    }
+    return (Timeout < Cap) ? Timeout : Cap;
+}
+
+static void EPD_4IN0E_BusyRecord(EPD_4IN0E_DEVICE *Dev, EPD_4IN0E_BUSY_PHASE Phase, UDOUBLE Elapsed)
+{
+    EPD_4IN0E_BUSY_STATS *St = &Dev->BusyStats[Phase];
+
+    if (St->Count == 0 || Elapsed < St->Min_ms) {
+        St->Min_ms = Elapsed;
+    }
+    if (Elapsed > St->Max_ms) {
+        St->Max_ms = Elapsed;
+    }
+    St->Last_ms = Elapsed;
+    St->Total_ms += Elapsed;
+    St->Count++;
+    St->Avg_ms = St->Total_ms / St->Count;
+}
+
+/******************************************************************************
+function :  Busy-wait statistics of a phase
+parameter:
+    Phase : Busy phase
+    Stats : Receives count and last/min/avg/max wait in ms
+******************************************************************************/
+void EPD_4IN0E_Dev_GetBusyStats(EPD_4IN0E_DEVICE *Dev, EPD_4IN0E_BUSY_PHASE Phase, EPD_4IN0E_BUSY_STATS *Stats)
+{
+    if (Phase < EPD_4IN0E_BUSY_PHASES) {
+        *Stats = Dev->BusyStats[Phase];
+    }
+}
+
+/******************************************************************************
+function :  Controller status flags
+parameter:
+    Status : Receives the 0x71 flags, bit0 BUSY_N
+return   :  0 read; 1 the controller did not answer
+******************************************************************************/
+UBYTE EPD_4IN0E_Dev_ReadStatus(EPD_4IN0E_DEVICE *Dev, UBYTE *Status)
 {
-    EPD_4IN0E_SendCommand(0x04); // POWER_ON
-    EPD_4IN0E_ReadBusyH_Optimized();
-    // 优化：等待时间从200ms减少到100ms
-    DEV_Delay_ms(100);
+    return DEV_Port_ReadReg(Dev->Port, 0x71, Status, 1);
+}
 
-    // Second setting
-    EPD_4IN0E_SendCommand(0x06);
-    EPD_4IN0E_SendData(0x6F);
-    EPD_4IN0E_SendData(0x1F);
-    EPD_4IN0E_SendData(0x17);
-    EPD_4IN0E_SendData(0x27);
-    // 优化：等待时间从200ms减少到100ms
-    DEV_Delay_ms(100);
+/******************************************************************************
+function :  Panel temperature from the built-in sensor
+parameter:
+    Temp_C : Receives whole degrees Celsius
+return   :  0 read; 1 the controller did not answer
+******************************************************************************/
+UBYTE EPD_4IN0E_Dev_ReadTemperature(EPD_4IN0E_DEVICE *Dev, int8_t *Temp_C)
+{
+    UBYTE Tsc[2];
 
-    EPD_4IN0E_SendCommand(0x12); // DISPLAY_REFRESH
-    EPD_4IN0E_SendData(0x00);
-    EPD_4IN0E_ReadBusyH_Optimized();
+    if (DEV_Port_ReadReg(Dev->Port, 0x40, Tsc, sizeof(Tsc)) != 0) {
+        return 1;
+    }
+    *Temp_C = (int8_t)Tsc[0];
+    return 0;
+}
 
-    EPD_4IN0E_SendCommand(0x02); // POWER_OFF
-    EPD_4IN0E_SendData(0X00);
-    EPD_4IN0E_ReadBusyH_Optimized();
+/******************************************************************************
+function :  Controller revision
+parameter:
+    Rev : Receives Len bytes of the 0x70 response
+    Len : Bytes wanted
+return   :  0 read; 1 the controller did not answer
+******************************************************************************/
+UBYTE EPD_4IN0E_Dev_ReadRevision(EPD_4IN0E_DEVICE *Dev, UBYTE *Rev, UBYTE Len)
+{
+    return DEV_Port_ReadReg(Dev->Port, 0x70, Rev, Len);
 }
 
 /**
- * Optimized display function with faster refresh
- * 优化版显示函数，比原版更快
- */
-void EPD_4IN0E_Display_Fast(UBYTE *Image)
+ * Read the temperature after a register load. Refresh busy times depend on
+ * it, so a move to another band drops the calibrated refresh timing.
+ **/
+static void EPD_4IN0E_UpdateTemp(EPD_4IN0E_DEVICE *Dev)
 {
-    UWORD Width, Height;
-    Width  = (EPD_4IN0E_WIDTH % 2 == 0) ? (EPD_4IN0E_WIDTH / 2) : (EPD_4IN0E_WIDTH / 2 + 1);
-    Height = EPD_4IN0E_HEIGHT;
+    UBYTE Band;
 
-    PR_DEBUG("Using FAST display mode\r\n");
-    EPD_4IN0E_SendCommand(0x10);
-    for (UWORD j = 0; j < Height; j++) {
-        for (UWORD i = 0; i < Width; i++) {
-            EPD_4IN0E_SendData(Image[i + j * Width]);
+    Dev->TempValid = (EPD_4IN0E_Dev_ReadTemperature(Dev, &Dev->Temp_C) == 0);
+    if (!Dev->TempValid) {
+        return;
+    }
+    Band = (UBYTE)((Dev->Temp_C + 128) / EPD_4IN0E_TEMP_BAND_C) + 1;
+    if (Dev->CalBand != 0 && Dev->CalBand != Band) {
+        Debug("e-Paper %d C: refresh timing recalibrated\r\n", Dev->Temp_C);
+        memset(&Dev->BusyStats[EPD_4IN0E_BUSY_REFRESH], 0, sizeof(Dev->BusyStats[0]));
+    }
+    Dev->CalBand = Band;
+}
+
+/******************************************************************************
+function :  Wait until the busy_pin goes HIGH (idle) and time the phase
+parameter:
+    Phase : Busy phase, selects the polling profile
+return   :  0 released, 1 timed out
+******************************************************************************/
+static UBYTE EPD_4IN0E_ReadBusyH(EPD_4IN0E_DEVICE *Dev, EPD_4IN0E_BUSY_PHASE Phase)
+{
+    UDOUBLE Start   = DEV_Get_ms();
+    UDOUBLE Poll    = EPD_4IN0E_BusyPoll(Dev, Phase);
+    UDOUBLE Timeout = EPD_4IN0E_BusyTimeout(Dev, Phase);
+    UDOUBLE Elapsed;
+    UBYTE   TimedOut = 0;
+
+    Debug("e-Paper busy H\r\n");
+    if (EPD_4IN0E_BusyLead(Dev, Phase)) {
+        DEV_Delay_ms(EPD_4IN0E_BusyLead(Dev, Phase));
+    }
+    while (!DEV_Digital_Read(Dev->Port->Busy)) { // LOW: busy, HIGH: idle
+        if (DEV_Get_ms() - Start > Timeout) {
+            Debug("e-Paper busy timeout (phase %d, %u ms)\r\n", Phase, Timeout);
+            TimedOut = 1;
+            break;
         }
-        // 优化：显示进度
-        if (j % 100 == 0) {
-            PR_DEBUG("Fast display progress: %d/%d lines\r\n", j, Height);
+        DEV_Delay_ms(Poll);
+    }
+    Elapsed = DEV_Get_ms() - Start;
+    if (!TimedOut) { // A stuck BUSY would teach ever longer timeouts
+        EPD_4IN0E_BusyRecord(Dev, Phase, Elapsed);
+    }
+    DEV_Delay_ms(EPD_4IN0E_SETTLE_MS);
+    Debug("e-Paper busy H release (phase %d, %u ms)\r\n", Phase, Elapsed);
+    return TimedOut;
+}
+
+/******************************************************************************
+function :  Send a register sequence
+parameter:
+     Seq   : Records, from flash
+     Count : Number of records
+******************************************************************************/
+static void EPD_4IN0E_SendSequence(EPD_4IN0E_DEVICE *Dev, const EPD_4IN0E_REG *Seq, UWORD Count)
+{
+    UWORD i;
+
+    for (i = 0; i < Count; i++) {
+        EPD_4IN0E_SendReg(Dev, &Seq[i]);
+        if (Seq[i].Wait == EPD_4IN0E_SEQ_SETTLE) {
+            DEV_Delay_ms(EPD_4IN0E_SETTLE_MS);
+        } else if (Seq[i].Wait < EPD_4IN0E_BUSY_PHASES) {
+            EPD_4IN0E_ReadBusyH(Dev, (EPD_4IN0E_BUSY_PHASE)Seq[i].Wait);
         }
     }
-    // 使用优化的刷新函数
-    EPD_4IN0E_TurnOnDisplay_Optimized();
-    PR_DEBUG("Fast display completed\r\n");
 }
 
 /******************************************************************************
-function :  Enter sleep mode
+function :  Turn On Display
 parameter:
 ******************************************************************************/
-void EPD_4IN0E_Sleep(void)
+static void EPD_4IN0E_TurnOnDisplay(EPD_4IN0E_DEVICE *Dev)
 {
-    EPD_4IN0E_SendCommand(0x07); // DEEP_SLEEP
-    EPD_4IN0E_SendData(0XA5);
-    // EPD_4IN0E_ReadBusyH();
+    // POWER_ON, second setting, DISPLAY_REFRESH, POWER_OFF
+    EPD_4IN0E_SendSequence(Dev, EPD_4IN0E_RefreshSeq, EPD_4IN0E_SEQ_LEN(EPD_4IN0E_RefreshSeq));
+
+    EPD_4IN0E_CommitShown(Dev);
+}
+
+/******************************************************************************
+function :  Load the registers after a reset
+parameter:
+    Start : Tick the reset began, for the log
+******************************************************************************/
+static void EPD_4IN0E_LoadRegisters(EPD_4IN0E_DEVICE *Dev, UDOUBLE Start)
+{
+    UDOUBLE Regs;
+
+    EPD_4IN0E_ReadBusyH(Dev, EPD_4IN0E_BUSY_RESET);
+
+    Regs = DEV_Get_ms();
+    EPD_4IN0E_SendSequence(Dev, EPD_4IN0E_InitSeq, EPD_4IN0E_SEQ_LEN(EPD_4IN0E_InitSeq));
+    Regs = DEV_Get_ms() - Regs;
+
+    EPD_4IN0E_ReadBusyH(Dev, EPD_4IN0E_BUSY_INIT);
+    EPD_4IN0E_UpdateTemp(Dev);
+    Dev->Session.State = EPD_4IN0E_PANEL_READY;
+    Debug("e-Paper init %u ms (registers %u ms)\r\n", DEV_Get_ms() - Start, Regs);
+}
+
+/******************************************************************************
+function :  Initialize the e-Paper register
+parameter:
+******************************************************************************/
+void EPD_4IN0E_Dev_Init(EPD_4IN0E_DEVICE *Dev)
+{
+    UDOUBLE Start = DEV_Get_ms();
+
+    EPD_4IN0E_Reset(Dev);
+    EPD_4IN0E_LoadRegisters(Dev, Start);
+}
+
+/******************************************************************************
+function :  Clear screen
+parameter:
+******************************************************************************/
+void EPD_4IN0E_Dev_Clear(EPD_4IN0E_DEVICE *Dev, UBYTE color)
+{
+    EPD_4IN0E_BeginData(Dev, 0x10);
+    EPD_4IN0E_FillData(Dev, (color << 4) | color, EPD_4IN0E_FRAME_BYTES(Dev));
+    EPD_4IN0E_EndData(Dev);
+
+    EPD_4IN0E_TurnOnDisplay(Dev);
+}
+
+/******************************************************************************
+function :  show 7 kind of color block
+parameter:
+******************************************************************************/
+void EPD_4IN0E_Dev_Show7Block(EPD_4IN0E_DEVICE *Dev)
+{
+    unsigned long       k;
+    unsigned char const Color_seven[6] = {EPD_4IN0E_BLACK, EPD_4IN0E_YELLOW, EPD_4IN0E_RED,
+                                          EPD_4IN0E_BLUE,  EPD_4IN0E_GREEN,  EPD_4IN0E_WHITE};
+
+    EPD_4IN0E_BeginData(Dev, 0x10);
+    for (k = 0; k < 6; k++) {
+        EPD_4IN0E_FillData(Dev, (Color_seven[k] << 4) | Color_seven[k], EPD_4IN0E_FRAME_BYTES(Dev) / 6);
+    }
+    EPD_4IN0E_EndData(Dev);
+    EPD_4IN0E_TurnOnDisplay(Dev);
+}
+
+void EPD_4IN0E_Dev_Show(EPD_4IN0E_DEVICE *Dev)
+{
+    unsigned long       k, o;
+    unsigned char const Color_seven[6] = {EPD_4IN0E_BLACK, EPD_4IN0E_YELLOW, EPD_4IN0E_RED,
+                                          EPD_4IN0E_BLUE,  EPD_4IN0E_GREEN,  EPD_4IN0E_WHITE};
+
+    UWORD Width, Height;
+    Width  = (Dev->Width % 2 == 0) ? (Dev->Width / 2) : (Dev->Width / 2 + 1);
+    Height = Dev->Height;
+    k      = 0;
+    o      = 0;
+
+    EPD_4IN0E_BeginData(Dev, 0x10);
+    for (UWORD j = 0; j < Height; j++) {
+        if ((j > 10) && (j < 50))
+            EPD_4IN0E_FillData(Dev, (Color_seven[0] << 4) | Color_seven[0], Width);
+        else if (o < Height / 2)
+            EPD_4IN0E_FillData(Dev, (Color_seven[0] << 4) | Color_seven[0], Width);
+
+        else {
+            EPD_4IN0E_FillData(Dev, (Color_seven[k] << 4) | Color_seven[k], Width);
+            k++;
+            if (k >= 6)
+                k = 0;
+        }
+
+        o++;
+        if (o >= Height)
+            o = 0;
+    }
+    EPD_4IN0E_EndData(Dev);
+    EPD_4IN0E_TurnOnDisplay(Dev);
+}
+
+/**
+ * Busy phase behind an asynchronous wait state
+ **/
+static EPD_4IN0E_BUSY_PHASE EPD_4IN0E_AsyncPhase(EPD_4IN0E_ASYNC_STATE State)
+{
+    if (State == EPD_4IN0E_ASYNC_POWER_ON) {
+        return EPD_4IN0E_BUSY_POWER_ON;
+    } else if (State == EPD_4IN0E_ASYNC_REFRESH) {
+        return EPD_4IN0E_BUSY_REFRESH;
+    }
+    return EPD_4IN0E_BUSY_POWER_OFF;
+}
+
+/**
+ * Enter an asynchronous wait state, polling at the phase's calibrated rate
+ **/
+static void EPD_4IN0E_AsyncWaitBusy(EPD_4IN0E_DEVICE *Dev, EPD_4IN0E_ASYNC_STATE State, UDOUBLE Now)
+{
+    EPD_4IN0E_BUSY_PHASE Phase = EPD_4IN0E_AsyncPhase(State);
+    UDOUBLE              Poll  = EPD_4IN0E_BusyPoll(Dev, Phase);
+
+    Dev->AsyncPhaseStart = Now;
+    Dev->AsyncHold       = Now + EPD_4IN0E_BusyLead(Dev, Phase);
+    Dev->AsyncState      = State;
+    tal_sw_timer_start(Dev->AsyncTimer, (Poll > EPD_4IN0E_ASYNC_POLL_MS) ? Poll : EPD_4IN0E_ASYNC_POLL_MS,
+                       TAL_TIMER_CYCLE);
+}
+
+/******************************************************************************
+function :  One step of the asynchronous refresh, run from the poll timer
+parameter:
+info:
+    Same sequence and busy profiles as EPD_4IN0E_TurnOnDisplay(), but the
+    waits are timer ticks instead of a blocked thread.
+******************************************************************************/
+static void EPD_4IN0E_AsyncTick(TIMER_ID timer_id, void *arg)
+{
+    EPD_4IN0E_DEVICE *Dev = (EPD_4IN0E_DEVICE *)arg;
+    UDOUBLE           Now = DEV_Get_ms();
+    (void)timer_id;
+
+    if ((int32_t)(Now - Dev->AsyncHold) < 0) {
+        return;
+    }
+
+    switch (Dev->AsyncState) {
+    case EPD_4IN0E_ASYNC_POWER_ON:
+    case EPD_4IN0E_ASYNC_REFRESH:
+    case EPD_4IN0E_ASYNC_POWER_OFF: {
+        EPD_4IN0E_BUSY_PHASE Phase = EPD_4IN0E_AsyncPhase(Dev->AsyncState);
+        UDOUBLE              Elapsed = Now - Dev->AsyncPhaseStart;
+
+        if (!DEV_Digital_Read(Dev->Port->Busy)) { // LOW: busy
+            if (Elapsed <= EPD_4IN0E_BusyTimeout(Dev, Phase)) {
+                return;
+            }
+            Debug("e-Paper busy timeout (phase %d, async)\r\n", Phase);
+        } else {
+            EPD_4IN0E_BusyRecord(Dev, Phase, Elapsed);
+        }
+        Debug("e-Paper busy H release (phase %d, async, %u ms)\r\n", Phase, Elapsed);
+        Dev->AsyncHold = Now + EPD_4IN0E_SETTLE_MS;
+        Dev->AsyncState++;
+        tal_sw_timer_start(Dev->AsyncTimer, EPD_4IN0E_ASYNC_POLL_MS, TAL_TIMER_CYCLE);
+        break;
+    }
+
+    case EPD_4IN0E_ASYNC_SECOND_SET:
+        EPD_4IN0E_SendReg(Dev, &EPD_4IN0E_RefreshSeq[EPD_4IN0E_STEP_SECOND_SET]);
+        Dev->AsyncHold  = Now + EPD_4IN0E_SETTLE_MS;
+        Dev->AsyncState = EPD_4IN0E_ASYNC_START_REFRESH;
+        break;
+
+    case EPD_4IN0E_ASYNC_START_REFRESH:
+        EPD_4IN0E_SendReg(Dev, &EPD_4IN0E_RefreshSeq[EPD_4IN0E_STEP_REFRESH]);
+        EPD_4IN0E_AsyncWaitBusy(Dev, EPD_4IN0E_ASYNC_REFRESH, Now);
+        break;
+
+    case EPD_4IN0E_ASYNC_START_OFF:
+        EPD_4IN0E_SendReg(Dev, &EPD_4IN0E_RefreshSeq[EPD_4IN0E_STEP_POWER_OFF]);
+        EPD_4IN0E_AsyncWaitBusy(Dev, EPD_4IN0E_ASYNC_POWER_OFF, Now);
+        break;
+
+    case EPD_4IN0E_ASYNC_FINISH:
+        tal_sw_timer_stop(Dev->AsyncTimer);
+        Debug("e-Paper async refresh done in %u ms\r\n", Now - Dev->AsyncStart);
+        EPD_4IN0E_CommitShown(Dev);
+        if (Dev->AsyncCb) {
+            Dev->AsyncCb(Dev->AsyncArg);
+        }
+        // Idle only once Cb is done with the SPI, so a waiter cannot reopen the port under it
+        Dev->AsyncState = EPD_4IN0E_ASYNC_IDLE;
+        tal_semaphore_post(Dev->AsyncDone);
+        break;
+
+    default:
+        break;
+    }
+}
+
+/******************************************************************************
+function :  Start POWER_ON / DISPLAY_REFRESH / POWER_OFF without blocking
+parameter:
+    Cb  : Called when the panel is powered off again, may be NULL.
+          Runs in the timer thread: keep it short. The refresh still
+          counts as running until it returns, so it cannot start another.
+    Arg : Passed to Cb
+return   :  0 started; 1 a refresh is already running or no timer
+******************************************************************************/
+UBYTE EPD_4IN0E_Dev_RefreshAsync(EPD_4IN0E_DEVICE *Dev, EPD_4IN0E_REFRESH_CB Cb, void *Arg)
+{
+    if (Dev->AsyncState != EPD_4IN0E_ASYNC_IDLE) {
+        Debug("e-Paper refresh already running\r\n");
+        return 1;
+    }
+    if (Dev->AsyncTimer == NULL) {
+        if (tal_semaphore_create_init(&Dev->AsyncDone, 0, 1) != OPRT_OK ||
+            tal_sw_timer_create(EPD_4IN0E_AsyncTick, Dev, &Dev->AsyncTimer) != OPRT_OK) {
+            Debug("e-Paper async refresh: no timer\r\n");
+            Dev->AsyncTimer = NULL;
+            return 1;
+        }
+    }
+
+    Dev->AsyncCb    = Cb;
+    Dev->AsyncArg   = Arg;
+    Dev->AsyncStart = DEV_Get_ms();
+    Dev->AsyncHold  = Dev->AsyncStart;
+
+    EPD_4IN0E_SendReg(Dev, &EPD_4IN0E_RefreshSeq[EPD_4IN0E_STEP_POWER_ON]);
+    EPD_4IN0E_AsyncWaitBusy(Dev, EPD_4IN0E_ASYNC_POWER_ON, Dev->AsyncStart);
+    return 0;
+}
+
+/******************************************************************************
+function :  Whether an asynchronous refresh is still running
+parameter:
+******************************************************************************/
+UBYTE EPD_4IN0E_Dev_IsRefreshing(EPD_4IN0E_DEVICE *Dev)
+{
+    return Dev->AsyncState != EPD_4IN0E_ASYNC_IDLE;
+}
+
+/******************************************************************************
+function :  Block until the asynchronous refresh has finished
+parameter:
+    Timeout_ms : Longest wait
+return   :  0 finished (or none running); 1 timeout
+info:
+    Sleeps on the completion semaphore, which is posted after the refresh
+    callback has returned. A post left by an earlier refresh nobody waited
+    for wakes it early; the refresh is then still running and it waits on.
+******************************************************************************/
+UBYTE EPD_4IN0E_Dev_WaitRefresh(EPD_4IN0E_DEVICE *Dev, UDOUBLE Timeout_ms)
+{
+    UDOUBLE Start = DEV_Get_ms();
+    UDOUBLE Elapsed;
+
+    if (Dev->AsyncTimer == NULL) {
+        return 0;
+    }
+    while (EPD_4IN0E_Dev_IsRefreshing(Dev)) {
+        Elapsed = DEV_Get_ms() - Start;
+        if (Elapsed >= Timeout_ms || tal_semaphore_wait(Dev->AsyncDone, Timeout_ms - Elapsed) != OPRT_OK) {
+            Debug("e-Paper wait refresh timeout\r\n");
+            return 1;
+        }
+    }
+    // Drop a completion that nobody waited for
+    tal_semaphore_wait(Dev->AsyncDone, 0);
+    return 0;
+}
+
+/******************************************************************************
+function :  Sends the image buffer in RAM to e-Paper and displays
+parameter:
+******************************************************************************/
+void EPD_4IN0E_Dev_Display(EPD_4IN0E_DEVICE *Dev, UBYTE *Image)
+{
+    EPD_4IN0E_BeginData(Dev, 0x10);
+    Dev->PendingSum   = EPD_4IN0E_Dev_FrameChecksum(Dev, Image);
+    Dev->PendingValid = 1;
+    if (Dev->LutOn || Dev->Orient.On) {
+        EPD_4IN0E_StreamImage(Dev, Image);
+    } else {
+        EPD_4IN0E_WriteData(Dev, Image, EPD_4IN0E_FRAME_BYTES(Dev));
+    }
+    EPD_4IN0E_EndData(Dev);
+    EPD_4IN0E_TurnOnDisplay(Dev);
+}
+
+/**
+ * Optimized display function with faster refresh
+ * 优化版显示函数，比原版更快
+ */
+void EPD_4IN0E_Dev_Display_Fast(EPD_4IN0E_DEVICE *Dev, UBYTE *Image)
+{
+    UDOUBLE Sum = EPD_4IN0E_Dev_FrameChecksum(Dev, Image);
+
+    // 优化：与屏上画面相同则跳过上传和整个刷新过程
+    EPD_4IN0E_LoadShown(Dev);
+    if (Dev->ShownState == 1 && Dev->ShownSum == Sum) {
+        PR_DEBUG("Frame %08x already shown, skip refresh\r\n", Sum);
+        return;
+    }
+
+    PR_DEBUG("Using FAST display mode\r\n");
+    // 优化：DC/CS 只拉一次，双缓冲流式发送，准备下一块与 SPI 传输重叠
+    EPD_4IN0E_BeginData(Dev, 0x10);
+    Dev->PendingSum   = Sum;
+    Dev->PendingValid = 1;
+    EPD_4IN0E_StreamImage(Dev, Image);
+    EPD_4IN0E_EndData(Dev);
+    PR_DEBUG("Fast display upload: %u bytes, %u bursts, %u ms (%u B/s), fill %u ms, wait %u ms\r\n",
+             Dev->Transfer.Bytes, Dev->Transfer.Bursts, Dev->Transfer.Time_ms,
+             Dev->Transfer.BytesPerSec, Dev->Stream.Stats.Fill_ms, Dev->Stream.Stats.Wait_ms);
+    EPD_4IN0E_TurnOnDisplay(Dev);
+    PR_DEBUG("Fast display completed\r\n");
+}
+
+/**
+ * Fill wrapper that fingerprints the source bytes and remaps them to the
+ * panel palette on their way out
+ **/
+typedef struct {
+    EPD_4IN0E_DEVICE *Dev;
+    DEV_STREAM_FILL   Fill;
+    void             *Arg;
+    EPD_4IN0E_HASH    Hash;
+} EPD_4IN0E_HASH_FILL;
+
+static UDOUBLE EPD_4IN0E_HashFill(UBYTE *Buf, UDOUBLE Size, UDOUBLE Offset, void *Arg)
+{
+    EPD_4IN0E_HASH_FILL *Hash = (EPD_4IN0E_HASH_FILL *)Arg;
+    EPD_4IN0E_DEVICE    *Dev  = Hash->Dev;
+    UDOUBLE              Len  = Hash->Fill(Buf, Size, Offset, Hash->Arg);
+    UDOUBLE              i;
+
+    EPD_4IN0E_HashUpdate(&Hash->Hash, Buf, Len);
+    if (Dev->LutOn) {
+        for (i = 0; i < Len; i++) {
+            Buf[i] = Dev->Lut[Buf[i]];
+        }
+    }
+    return Len;
+}
+
+/******************************************************************************
+function :  Load a frame produced by Fill into the controller
+parameter:
+    Fill : Frame source
+    Arg  : Passed to Fill
+return   :  0 the whole frame arrived; 1 Fill ended the stream early
+******************************************************************************/
+static UBYTE EPD_4IN0E_UploadStream(EPD_4IN0E_DEVICE *Dev, DEV_STREAM_FILL Fill, void *Arg)
+{
+    EPD_4IN0E_HASH_FILL Hash = {Dev, Fill, Arg, {EPD_4IN0E_HASH_SEED ^ Dev->PaletteSum, {0}, 0}}; // Not reoriented
+
+    EPD_4IN0E_BeginData(Dev, 0x10);
+    EPD_4IN0E_StreamData(Dev, EPD_4IN0E_HashFill, &Hash, EPD_4IN0E_FRAME_BYTES(Dev));
+    EPD_4IN0E_EndData(Dev);
+
+    if (Dev->Transfer.Bytes < EPD_4IN0E_FRAME_BYTES(Dev)) {
+        Debug("e-Paper stream ended at %u/%u bytes\r\n", Dev->Transfer.Bytes, EPD_4IN0E_FRAME_BYTES(Dev));
+        return 1;
+    }
+    Dev->PendingSum   = EPD_4IN0E_HashFinish(&Hash.Hash);
+    Dev->PendingValid = 1;
+    return 0;
+}
+
+/******************************************************************************
+function :  Sends a frame produced by Fill to e-Paper and displays
+parameter:
+    Fill : Called for each chunk of the frame, in order; may transform
+           (remap, rotate, decompress...) while the previous chunk is sent.
+           Filling every chunk completely keeps the fingerprint equal to
+           EPD_4IN0E_Dev_FrameChecksum() of the same frame.
+    Arg  : Passed to Fill
+return   :  0 displayed or already shown; 1 the stream ended early, no refresh
+******************************************************************************/
+UBYTE EPD_4IN0E_Dev_Display_Stream(EPD_4IN0E_DEVICE *Dev, DEV_STREAM_FILL Fill, void *Arg)
+{
+    if (EPD_4IN0E_UploadStream(Dev, Fill, Arg) != 0) {
+        return 1;
+    }
+    if (EPD_4IN0E_PendingShown(Dev)) {
+        Debug("e-Paper frame already shown, skip refresh\r\n");
+        return 0;
+    }
+    EPD_4IN0E_TurnOnDisplay(Dev);
+    return 0;
+}
+
+/******************************************************************************
+function :  Sends the image buffer to e-Paper and starts the refresh
+            without waiting for it
+parameter:
+    Image : Frame buffer, no longer needed once this returns
+    Cb    : See EPD_4IN0E_Dev_RefreshAsync()
+    Arg   : Passed to Cb
+return   :  0 refresh started; 1 see EPD_4IN0E_Dev_RefreshAsync()
+******************************************************************************/
+UBYTE EPD_4IN0E_Dev_Display_Async(EPD_4IN0E_DEVICE *Dev, UBYTE *Image, EPD_4IN0E_REFRESH_CB Cb, void *Arg)
+{
+    if (EPD_4IN0E_Dev_IsRefreshing(Dev)) {
+        Debug("e-Paper refresh already running\r\n");
+        return 1;
+    }
+    if (EPD_4IN0E_Dev_IsFrameShown(Dev, Image)) {
+        Debug("e-Paper frame already shown, skip refresh\r\n");
+        if (Cb) {
+            Cb(Arg);
+        }
+        return 0;
+    }
+    EPD_4IN0E_BeginData(Dev, 0x10);
+    Dev->PendingSum   = EPD_4IN0E_Dev_FrameChecksum(Dev, Image);
+    Dev->PendingValid = 1;
+    EPD_4IN0E_StreamImage(Dev, Image);
+    EPD_4IN0E_EndData(Dev);
+    return EPD_4IN0E_Dev_RefreshAsync(Dev, Cb, Arg);
+}
+
+/******************************************************************************
+function :  Stream a frame in, then refresh in the background
+parameter:
+    Fill  : Frame source, see EPD_4IN0E_Dev_Display_Stream()
+    Arg   : Passed to Fill
+    Cb    : Called once the panel is powered off again, may be NULL
+    CbArg : Passed to Cb
+return   :  0 refresh started, or already shown / done blocking (Cb has run);
+            1 a refresh is running or the stream ended early, Cb not called
+info:
+    The source is consumed while uploading, so when no timer is available
+    the refresh falls back to blocking rather than failing.
+******************************************************************************/
+UBYTE EPD_4IN0E_Dev_Display_StreamAsync(EPD_4IN0E_DEVICE *Dev, DEV_STREAM_FILL Fill, void *Arg, EPD_4IN0E_REFRESH_CB Cb, void *CbArg)
+{
+    if (EPD_4IN0E_Dev_IsRefreshing(Dev)) {
+        Debug("e-Paper refresh already running\r\n");
+        return 1;
+    }
+    if (EPD_4IN0E_UploadStream(Dev, Fill, Arg) != 0) {
+        return 1;
+    }
+    if (EPD_4IN0E_PendingShown(Dev)) {
+        Debug("e-Paper frame already shown, skip refresh\r\n");
+    } else if (EPD_4IN0E_Dev_RefreshAsync(Dev, Cb, CbArg) == 0) {
+        return 0;
+    } else {
+        EPD_4IN0E_TurnOnDisplay(Dev);
+    }
+    if (Cb) {
+        Cb(CbArg);
+    }
+    return 0;
+}
+
+/******************************************************************************
+function :  Enter sleep mode
+parameter:
+******************************************************************************/
+void EPD_4IN0E_Dev_Sleep(EPD_4IN0E_DEVICE *Dev)
+{
+    EPD_4IN0E_SendReg(Dev, &EPD_4IN0E_SleepReg);
+    Dev->Session.State = EPD_4IN0E_PANEL_SLEEP;
+    // EPD_4IN0E_ReadBusyH();
+}
+
+/******************************************************************************
+function :  Make the panel ready for a frame
+parameter:
+return   :  0 ready; 1 module init failed or a refresh is still running
+info:
+    OFF   : module init, full reset and register load (cold open)
+    SLEEP : short reset pulse and register load; SPI/GPIO are kept
+    READY : nothing to do
+    Deep sleep drops the controller settings, so the register load
+    itself cannot be skipped.
+******************************************************************************/
+UBYTE EPD_4IN0E_Dev_SessionOpen(EPD_4IN0E_DEVICE *Dev)
+{
+    EPD_4IN0E_SESSION *S     = &Dev->Session;
+    UDOUBLE            Start = DEV_Get_ms();
+    UBYTE              Cold  = 0;
+
+    if (EPD_4IN0E_Dev_IsRefreshing(Dev)) {
+        Debug("e-Paper session: refresh still running\r\n");
+        return 1;
+    }
+    if (!S->ModuleUp) {
+        EPD_4IN0E_LoadSpiFreq(Dev);
+        if (DEV_Port_Init(Dev->Port) != 0) {
+            return 1;
+        }
+        S->ModuleUp = 1;
+        S->State    = EPD_4IN0E_PANEL_OFF;
+    }
+
+    switch (S->State) {
+    case EPD_4IN0E_PANEL_SLEEP:
+        EPD_4IN0E_WakeReset(Dev);
+        EPD_4IN0E_LoadRegisters(Dev, Start);
+        break;
+    case EPD_4IN0E_PANEL_READY:
+        break;
+    default:
+        Cold = 1;
+        EPD_4IN0E_Reset(Dev);
+        EPD_4IN0E_LoadRegisters(Dev, Start);
+        break;
+    }
+
+    S->Opens++;
+    S->Setup_ms = DEV_Get_ms() - Start;
+    if (Cold) {
+        S->Cold_ms  = S->Setup_ms;
+        S->Saved_ms = 0;
+    } else {
+        S->Saved_ms = (S->Cold_ms > S->Setup_ms) ? S->Cold_ms - S->Setup_ms : 0;
+        S->SavedTotal_ms += S->Saved_ms;
+    }
+    Debug("e-Paper session open: %u ms, saved %u ms\r\n", S->Setup_ms, S->Saved_ms);
+    return 0;
+}
+
+/******************************************************************************
+function :  Put the panel into deep sleep, keep SPI and GPIO configured
+parameter:
+******************************************************************************/
+void EPD_4IN0E_Dev_SessionSleep(EPD_4IN0E_DEVICE *Dev)
+{
+    if (Dev->Session.ModuleUp && Dev->Session.State == EPD_4IN0E_PANEL_READY) {
+        EPD_4IN0E_Dev_Sleep(Dev);
+    }
+}
+
+/******************************************************************************
+function :  Sleep the panel and release SPI and GPIO
+parameter:
+******************************************************************************/
+void EPD_4IN0E_Dev_SessionClose(EPD_4IN0E_DEVICE *Dev)
+{
+    EPD_4IN0E_Dev_SessionSleep(Dev);
+    if (Dev->Session.ModuleUp) {
+        DEV_Port_Exit(Dev->Port);
+        Dev->Session.ModuleUp = 0;
+    }
+    Dev->Session.State = EPD_4IN0E_PANEL_OFF;
+}
+
+/******************************************************************************
+function :  Session state and setup time savings
+parameter:
+    Session : Receives a copy
+******************************************************************************/
+void EPD_4IN0E_Dev_GetSession(EPD_4IN0E_DEVICE *Dev, EPD_4IN0E_SESSION *Session)
+{
+    *Session = Dev->Session;
+}
+
+/******************************************************************************
+function :  One round of the SPI sweep at the current clock
+parameter:
+return   :  1 passed
+info:
+    Uploads the test frame, then runs POWER_ON and POWER_OFF. The controller
+    has no frame readback, so a round passes when it acted on the commands
+    sent at this clock: both BUSY waits end before their timeout and, where
+    the status register answers, its power flags follow.
+******************************************************************************/
+static UBYTE EPD_4IN0E_SweepRound(EPD_4IN0E_DEVICE *Dev)
+{
+    UBYTE k, Status, Ok = 1;
+
+    EPD_4IN0E_BeginData(Dev, 0x10);
+    for (k = 0; k < sizeof(EPD_4IN0E_SweepBands); k++) {
+        EPD_4IN0E_FillData(Dev, EPD_4IN0E_SweepBands[k], EPD_4IN0E_FRAME_BYTES(Dev) / sizeof(EPD_4IN0E_SweepBands));
+    }
+    EPD_4IN0E_EndData(Dev);
+
+    EPD_4IN0E_SendReg(Dev, &EPD_4IN0E_RefreshSeq[EPD_4IN0E_STEP_POWER_ON]);
+    if (EPD_4IN0E_ReadBusyH(Dev, EPD_4IN0E_BUSY_POWER_ON)) {
+        Ok = 0;
+    }
+    if (EPD_4IN0E_Dev_ReadStatus(Dev, &Status) == 0 && !(Status & 0x04)) {
+        Ok = 0;
+    }
+
+    EPD_4IN0E_SendReg(Dev, &EPD_4IN0E_RefreshSeq[EPD_4IN0E_STEP_POWER_OFF]);
+    if (EPD_4IN0E_ReadBusyH(Dev, EPD_4IN0E_BUSY_POWER_OFF)) {
+        Ok = 0;
+    }
+    if (EPD_4IN0E_Dev_ReadStatus(Dev, &Status) == 0 && !(Status & 0x02)) {
+        Ok = 0;
+    }
+    return Ok;
+}
+
+/******************************************************************************
+function :  SPI clock of the last sweep
+parameter:
+return   :  Clock in Hz, 0 if the panel was never swept
+info:
+    Reads KV on the first call and applies the clock to the port.
+******************************************************************************/
+UDOUBLE EPD_4IN0E_Dev_GetSpiFreq(EPD_4IN0E_DEVICE *Dev)
+{
+    EPD_4IN0E_LoadSpiFreq(Dev);
+    return Dev->SpiHz;
+}
+
+/******************************************************************************
+function :  Find the fastest SPI clock the panel takes reliably
+parameter:
+    Freqs : Clocks to try in ascending order, NULL for the built-in list
+    Count : Number of clocks in Freqs
+    Steps : Receives one record per clock, may be NULL
+return   :  Chosen clock in Hz; 0 if fewer than EPD_4IN0E_SWEEP_MARGIN + 1
+            clocks passed
+info:
+    Each clock must pass EPD_4IN0E_SWEEP_ROUNDS rounds of EPD_4IN0E_SweepRound();
+    the sweep stops at the first one that fails and backs off
+    EPD_4IN0E_SWEEP_MARGIN clocks from the last good one, as corrupted pixel
+    data cannot be detected. The back-off also applies when every clock
+    passes, so the chosen clock always has passing clocks above it. The
+    result is applied and stored under KvSpiKey. Without enough good clocks
+    nothing is stored and the slowest good one only runs this session.
+    Leaves the test frame in controller RAM without refreshing the panel.
+******************************************************************************/
+UDOUBLE EPD_4IN0E_Dev_SpiSweep(EPD_4IN0E_DEVICE *Dev, const UDOUBLE *Freqs, UBYTE Count,
+                               EPD_4IN0E_SWEEP_STEP *Steps)
+{
+    EPD_4IN0E_SWEEP_STEP Step;
+    UBYTE                i, r, Ok, Good = 0;
+
+    if (Freqs == NULL) {
+        Freqs = EPD_4IN0E_SweepFreqs;
+        Count = sizeof(EPD_4IN0E_SweepFreqs) / sizeof(EPD_4IN0E_SweepFreqs[0]);
+    }
+    if (Count == 0 || EPD_4IN0E_Dev_SessionOpen(Dev) != 0) {
+        return 0;
+    }
+    if (Steps) {
+        memset(Steps, 0, sizeof(*Steps) * Count);
+        for (i = 0; i < Count; i++) {
+            Steps[i].Hz = Freqs[i];
+        }
+    }
+
+    for (i = 0; i < Count; i++) {
+        memset(&Step, 0, sizeof(Step));
+        Step.Hz = Freqs[i];
+        DEV_Port_SetFreq(Dev->Port, Freqs[i]);
+        for (r = 0; r < EPD_4IN0E_SWEEP_ROUNDS; r++) {
+            Ok = EPD_4IN0E_SweepRound(Dev);
+            if (r == 0 || Dev->Transfer.Time_ms < Step.Time_ms) {
+                Step.Time_ms     = Dev->Transfer.Time_ms;
+                Step.BytesPerSec = Dev->Transfer.BytesPerSec;
+            }
+            if (!Ok) {
+                break;
+            }
+            Step.Passed++;
+        }
+        if (Steps) {
+            Steps[i] = Step;
+        }
+        Debug("e-Paper SPI %u Hz: %u ms, %u B/s, %d/%d rounds\r\n", Step.Hz, Step.Time_ms, Step.BytesPerSec,
+              Step.Passed, EPD_4IN0E_SWEEP_ROUNDS);
+        if (Step.Passed < EPD_4IN0E_SWEEP_ROUNDS) {
+            break;
+        }
+        Good = i + 1;
+    }
+
+    if (Good <= EPD_4IN0E_SWEEP_MARGIN) {
+        Debug("e-Paper SPI sweep: %d clocks passed, no margin\r\n", Good);
+        DEV_Port_SetFreq(Dev->Port, Good ? Freqs[0] : Dev->SpiHz);
+        return 0;
+    }
+    i = Good - 1 - EPD_4IN0E_SWEEP_MARGIN;
+    Dev->SpiHz     = Freqs[i];
+    Dev->SpiLoaded = 1;
+    DEV_Port_SetFreq(Dev->Port, Dev->SpiHz);
+    if (Dev->KvSpiKey) {
+        tal_kv_set(Dev->KvSpiKey, (const uint8_t *)&Dev->SpiHz, sizeof(Dev->SpiHz));
+    }
+    Debug("e-Paper SPI sweep: %u Hz\r\n", Dev->SpiHz);
+    return Dev->SpiHz;
+}
+
+/******************************************************************************
+function :  Prepare a device handle
+parameter:
+    Dev   : Handle, any previous content is dropped
+    Port  : Pins and SPI of the panel, NULL for DEV_DefaultPort
+    KvKey : KV key of the shown-frame fingerprint, one per panel;
+            NULL keeps the fingerprint in RAM only
+info:
+    Geometry starts at EPD_4IN0E_WIDTH x EPD_4IN0E_HEIGHT and may be changed
+    before the first SessionOpen()/Init(), as may KvSpiKey (NULL here).
+******************************************************************************/
+void EPD_4IN0E_Dev_Setup(EPD_4IN0E_DEVICE *Dev, const DEV_PORT *Port, const char *KvKey)
+{
+    memset(Dev, 0, sizeof(*Dev));
+    Dev->Port       = Port ? Port : &DEV_DefaultPort;
+    Dev->Width      = EPD_4IN0E_WIDTH;
+    Dev->Height     = EPD_4IN0E_HEIGHT;
+    Dev->KvKey      = KvKey;
+    Dev->AsyncState = EPD_4IN0E_ASYNC_IDLE;
+}
+
+/******************************************************************************
+function :  Device behind the EPD_4IN0E_* calls without a handle
+parameter:
+return   :  The panel on DEV_DefaultPort
+******************************************************************************/
+EPD_4IN0E_DEVICE *EPD_4IN0E_Default(void)
+{
+    if (EPD_4IN0E_DefaultDev.Port == NULL) {
+        EPD_4IN0E_Dev_Setup(&EPD_4IN0E_DefaultDev, &DEV_DefaultPort, EPD_4IN0E_KV_FRAME);
+        EPD_4IN0E_DefaultDev.KvSpiKey = EPD_4IN0E_KV_SPI;
+    }
+    return &EPD_4IN0E_DefaultDev;
+}
+
+/******************************************************************************
+ * Single-panel API, kept for existing callers
+******************************************************************************/
+void EPD_4IN0E_Init(void)
+{
+    EPD_4IN0E_Dev_Init(EPD_4IN0E_Default());
+}
+
+void EPD_4IN0E_Clear(UBYTE color)
+{
+    EPD_4IN0E_Dev_Clear(EPD_4IN0E_Default(), color);
+}
+
+void EPD_4IN0E_Show7Block(void)
+{
+    EPD_4IN0E_Dev_Show7Block(EPD_4IN0E_Default());
+}
+
+void EPD_4IN0E_Show(void)
+{
+    EPD_4IN0E_Dev_Show(EPD_4IN0E_Default());
+}
+
+void EPD_4IN0E_Display(UBYTE *Image)
+{
+    EPD_4IN0E_Dev_Display(EPD_4IN0E_Default(), Image);
+}
+
+void EPD_4IN0E_Sleep(void)
+{
+    EPD_4IN0E_Dev_Sleep(EPD_4IN0E_Default());
+}
+
+void EPD_4IN0E_Display_Fast(UBYTE *Image)
+{
+    EPD_4IN0E_Dev_Display_Fast(EPD_4IN0E_Default(), Image);
+}
+
+UBYTE EPD_4IN0E_Display_Stream(DEV_STREAM_FILL Fill, void *Arg)
+{
+    return EPD_4IN0E_Dev_Display_Stream(EPD_4IN0E_Default(), Fill, Arg);
+}
+
+void EPD_4IN0E_SetPalette(const UBYTE *Map)
+{
+    EPD_4IN0E_Dev_SetPalette(EPD_4IN0E_Default(), Map);
+}
+
+UBYTE EPD_4IN0E_SetOrientation(UWORD Rotate, UBYTE Mirror)
+{
+    return EPD_4IN0E_Dev_SetOrientation(EPD_4IN0E_Default(), Rotate, Mirror);
+}
+
+void EPD_4IN0E_GetTransferStats(EPD_4IN0E_TRANSFER_STATS *Stats)
+{
+    EPD_4IN0E_Dev_GetTransferStats(EPD_4IN0E_Default(), Stats);
+}
+
+void EPD_4IN0E_GetBusyStats(EPD_4IN0E_BUSY_PHASE Phase, EPD_4IN0E_BUSY_STATS *Stats)
+{
+    EPD_4IN0E_Dev_GetBusyStats(EPD_4IN0E_Default(), Phase, Stats);
+}
+
+UDOUBLE EPD_4IN0E_FrameChecksum(const UBYTE *Image)
+{
+    return EPD_4IN0E_Dev_FrameChecksum(EPD_4IN0E_Default(), Image);
+}
+
+UBYTE EPD_4IN0E_IsFrameShown(const UBYTE *Image)
+{
+    return EPD_4IN0E_Dev_IsFrameShown(EPD_4IN0E_Default(), Image);
+}
+
+UBYTE EPD_4IN0E_RefreshAsync(EPD_4IN0E_REFRESH_CB Cb, void *Arg)
+{
+    return EPD_4IN0E_Dev_RefreshAsync(EPD_4IN0E_Default(), Cb, Arg);
+}
+
+UBYTE EPD_4IN0E_Display_Async(UBYTE *Image, EPD_4IN0E_REFRESH_CB Cb, void *Arg)
+{
+    return EPD_4IN0E_Dev_Display_Async(EPD_4IN0E_Default(), Image, Cb, Arg);
+}
+
+UBYTE EPD_4IN0E_Display_StreamAsync(DEV_STREAM_FILL Fill, void *Arg, EPD_4IN0E_REFRESH_CB Cb, void *CbArg)
+{
+    return EPD_4IN0E_Dev_Display_StreamAsync(EPD_4IN0E_Default(), Fill, Arg, Cb, CbArg);
+}
+
+UBYTE EPD_4IN0E_IsRefreshing(void)
+{
+    return EPD_4IN0E_Dev_IsRefreshing(EPD_4IN0E_Default());
+}
+
+UBYTE EPD_4IN0E_WaitRefresh(UDOUBLE Timeout_ms)
+{
+    return EPD_4IN0E_Dev_WaitRefresh(EPD_4IN0E_Default(), Timeout_ms);
+}
+
+UBYTE EPD_4IN0E_SessionOpen(void)
+{
+    return EPD_4IN0E_Dev_SessionOpen(EPD_4IN0E_Default());
+}
+
+void EPD_4IN0E_SessionSleep(void)
+{
+    EPD_4IN0E_Dev_SessionSleep(EPD_4IN0E_Default());
+}
+
+void EPD_4IN0E_SessionClose(void)
+{
+    EPD_4IN0E_Dev_SessionClose(EPD_4IN0E_Default());
+}
+
+void EPD_4IN0E_GetSession(EPD_4IN0E_SESSION *Session)
+{
+    EPD_4IN0E_Dev_GetSession(EPD_4IN0E_Default(), Session);
+}
+
+UBYTE EPD_4IN0E_ReadStatus(UBYTE *Status)
+{
+    return EPD_4IN0E_Dev_ReadStatus(EPD_4IN0E_Default(), Status);
+}
+
+UBYTE EPD_4IN0E_ReadTemperature(int8_t *Temp_C)
+{
+    return EPD_4IN0E_Dev_ReadTemperature(EPD_4IN0E_Default(), Temp_C);
+}
+
+UBYTE EPD_4IN0E_ReadRevision(UBYTE *Rev, UBYTE Len)
+{
+    return EPD_4IN0E_Dev_ReadRevision(EPD_4IN0E_Default(), Rev, Len);
+}
+
+UDOUBLE EPD_4IN0E_SpiSweep(const UDOUBLE *Freqs, UBYTE Count, EPD_4IN0E_SWEEP_STEP *Steps)
+{
+    return EPD_4IN0E_Dev_SpiSweep(EPD_4IN0E_Default(), Freqs, Count, Steps);
+}
+
+UDOUBLE EPD_4IN0E_GetSpiFreq(void)
+{
+    return EPD_4IN0E_Dev_GetSpiFreq(EPD_4IN0E_Default());
 }
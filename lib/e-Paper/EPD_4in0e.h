@@ -32,6 +32,7 @@
 #define __EPD_4IN0E_H_
 
 #include "DEV_Config.h"
+#include "DEV_Stream.h"
 
 // Display resolution
 #define EPD_4IN0E_WIDTH  400
@@ -47,6 +48,180 @@ Color Index
 #define EPD_4IN0E_BLUE   0x5 /// 101
 #define EPD_4IN0E_GREEN  0x6 /// 110
 
+// Largest single SPI write used when streaming frame data
+#define EPD_4IN0E_BURST_SIZE 4096
+
+// BUSY polling period of the asynchronous refresh
+#define EPD_4IN0E_ASYNC_POLL_MS 20
+
+// Bounds of the calibrated BUSY polling interval
+#define EPD_4IN0E_BUSY_POLL_MIN_MS 2
+#define EPD_4IN0E_BUSY_POLL_MAX_MS 200
+
+// A learned BUSY timeout never exceeds this many times the phase default
+#define EPD_4IN0E_BUSY_TIMEOUT_CAP 4
+
+// Settle time after BUSY is released, replaces the fixed 100/200 ms padding
+#ifndef EPD_4IN0E_SETTLE_MS
+#define EPD_4IN0E_SETTLE_MS 10
+#endif
+
+// Refresh timing is recalibrated when the temperature moves to another band
+#ifndef EPD_4IN0E_TEMP_BAND_C
+#define EPD_4IN0E_TEMP_BAND_C 10
+#endif
+// Below this the refresh timeout is doubled
+#define EPD_4IN0E_TEMP_COLD_C 5
+
+// SPI clock sweep: rounds every clock must pass, clocks to back off from the fastest good one
+#ifndef EPD_4IN0E_SWEEP_ROUNDS
+#define EPD_4IN0E_SWEEP_ROUNDS 3
+#endif
+#ifndef EPD_4IN0E_SWEEP_MARGIN
+#define EPD_4IN0E_SWEEP_MARGIN 1
+#endif
+
+/**
+ * Busy phases, timed separately
+ **/
+typedef enum {
+    EPD_4IN0E_BUSY_RESET = 0, // After hardware reset
+    EPD_4IN0E_BUSY_INIT,      // After the register load
+    EPD_4IN0E_BUSY_POWER_ON,  // 0x04
+    EPD_4IN0E_BUSY_REFRESH,   // 0x12
+    EPD_4IN0E_BUSY_POWER_OFF, // 0x02
+    EPD_4IN0E_BUSY_PHASES,
+} EPD_4IN0E_BUSY_PHASE;
+
+/**
+ * Measured busy time of a phase
+ **/
+typedef struct {
+    UDOUBLE Count;
+    UDOUBLE Last_ms;
+    UDOUBLE Min_ms;
+    UDOUBLE Avg_ms;
+    UDOUBLE Max_ms;
+    UDOUBLE Total_ms;
+} EPD_4IN0E_BUSY_STATS;
+
+/**
+ * Called once an asynchronous refresh has powered the panel off again
+ **/
+typedef void (*EPD_4IN0E_REFRESH_CB)(void *Arg);
+
+/**
+ * Statistics of the last frame transfer
+ **/
+typedef struct {
+    UDOUBLE Bytes;       // Data bytes sent after the command
+    UDOUBLE Bursts;      // Number of DEV_SPI_Write_nByte() calls
+    UDOUBLE Time_ms;     // Wall time of the data phase
+    UDOUBLE BytesPerSec; // Throughput of the data phase
+} EPD_4IN0E_TRANSFER_STATS;
+
+/**
+ * One clock of an SPI sweep
+ **/
+typedef struct {
+    UDOUBLE Hz;
+    UDOUBLE Time_ms;     // Fastest upload of the test frame
+    UDOUBLE BytesPerSec; // Throughput of that upload
+    UBYTE   Passed;      // Rounds passed, EPD_4IN0E_SWEEP_ROUNDS when reliable
+} EPD_4IN0E_SWEEP_STEP;
+
+/**
+ * Controller state tracked by the panel session
+ **/
+typedef enum {
+    EPD_4IN0E_PANEL_OFF = 0, // Module down or never initialised
+    EPD_4IN0E_PANEL_READY,   // Registers loaded, accepts frames
+    EPD_4IN0E_PANEL_SLEEP,   // Deep sleep, SPI and GPIO still configured
+} EPD_4IN0E_PANEL_STATE;
+
+/**
+ * Panel session: keeps the module up between frames
+ **/
+typedef struct {
+    EPD_4IN0E_PANEL_STATE State;
+    UBYTE   ModuleUp;      // DEV_Module_Init() done and not undone
+    UDOUBLE Opens;         // EPD_4IN0E_SessionOpen() calls
+    UDOUBLE Setup_ms;      // Setup time of the last open
+    UDOUBLE Cold_ms;       // Setup time of a cold open: module init, reset and full init
+    UDOUBLE Saved_ms;      // Cold_ms minus Setup_ms of the last open
+    UDOUBLE SavedTotal_ms; // Sum of Saved_ms
+} EPD_4IN0E_SESSION;
+
+/**
+ * Upload orientation for EPD_4IN0E_SetOrientation(), same values as GUI_Paint
+ **/
+#define EPD_4IN0E_ROTATE_0   0
+#define EPD_4IN0E_ROTATE_90  90
+#define EPD_4IN0E_ROTATE_180 180
+#define EPD_4IN0E_ROTATE_270 270
+
+#define EPD_4IN0E_MIRROR_NONE       0x00
+#define EPD_4IN0E_MIRROR_HORIZONTAL 0x01
+#define EPD_4IN0E_MIRROR_VERTICAL   0x02
+#define EPD_4IN0E_MIRROR_ORIGIN     0x03
+
+/**
+ * One panel: its port, geometry and all driver state.
+ * Set up with EPD_4IN0E_Dev_Setup(); the other fields belong to the driver.
+ * Each device may be driven from its own thread, calls on one device must not overlap.
+ **/
+typedef struct {
+    const DEV_PORT *Port;  // Pins and SPI of this panel
+    UWORD           Width;
+    UWORD           Height;
+    const char     *KvKey;    // KV key of the shown-frame fingerprint
+    const char     *KvSpiKey; // KV key of the swept SPI clock, NULL: not stored
+
+    EPD_4IN0E_SESSION        Session;
+    EPD_4IN0E_TRANSFER_STATS Transfer;
+    UDOUBLE                  TransferStart;
+    DEV_STREAM               Stream;
+    UBYTE                    FillBuf[EPD_4IN0E_BURST_SIZE];
+
+    volatile UBYTE       AsyncState; // EPD_4IN0E_ASYNC_* step
+    UDOUBLE              AsyncHold;  // Next step not before this tick
+    UDOUBLE              AsyncStart;
+    UDOUBLE              AsyncPhaseStart;
+    EPD_4IN0E_REFRESH_CB AsyncCb;
+    void                *AsyncArg;
+    TIMER_ID             AsyncTimer;
+    SEM_HANDLE           AsyncDone;
+
+    EPD_4IN0E_BUSY_STATS BusyStats[EPD_4IN0E_BUSY_PHASES];
+
+    UDOUBLE ShownSum;
+    UBYTE   ShownState;   // 0: not loaded, 1: known, 2: unknown
+    UDOUBLE PendingSum;   // Frame in controller RAM, shown after refresh
+    UBYTE   PendingValid; // 0: RAM holds something without a fingerprint
+
+    UBYTE   Lut[256];
+    UBYTE   LutOn;      // 0: source indices are panel indices
+    UDOUBLE PaletteSum; // Mixed into frame fingerprints, 0 without remap
+
+    int8_t Temp_C;    // Last temperature read at register load
+    UBYTE  TempValid; // 0: the controller did not answer
+    UBYTE  CalBand;   // Temperature band of the refresh timing + 1, 0: none
+
+    UDOUBLE SpiHz;     // SPI clock found by the last sweep, 0: port default
+    UBYTE   SpiLoaded; // SpiHz read from KV
+
+    struct {
+        UBYTE   On;
+        UBYTE   Transpose;
+        UBYTE   FlipX;
+        UBYTE   FlipY;
+        UDOUBLE Sum;
+    } Orient;
+} EPD_4IN0E_DEVICE;
+
+// Palette profiles for EPD_4IN0E_SetPalette(): panel color per source index
+extern const UBYTE EPD_4IN0E_PALETTE_SEQUENTIAL[16];
+
 void EPD_4IN0E_Init(void);
 void EPD_4IN0E_Clear(UBYTE color);
 void EPD_4IN0E_Show7Block(void);
@@ -57,4 +232,82 @@ void EPD_4IN0E_Sleep(void);
 // Optimized display function - faster version
 void EPD_4IN0E_Display_Fast(UBYTE *Image);
 
+// Upload a frame produced chunk by chunk, overlapping Fill with the SPI.
+// No refresh unless Fill delivered the whole frame.
+UBYTE EPD_4IN0E_Display_Stream(DEV_STREAM_FILL Fill, void *Arg);
+
+// Remap source color indices while uploading frames (Display*, not Clear/Show)
+void EPD_4IN0E_SetPalette(const UBYTE *Map);
+
+// Rotate/mirror frame buffers while uploading; 90/270 take a 600 x 400 landscape source
+UBYTE EPD_4IN0E_SetOrientation(UWORD Rotate, UBYTE Mirror);
+
+void EPD_4IN0E_GetTransferStats(EPD_4IN0E_TRANSFER_STATS *Stats);
+void EPD_4IN0E_GetBusyStats(EPD_4IN0E_BUSY_PHASE Phase, EPD_4IN0E_BUSY_STATS *Stats);
+
+// Fingerprint of the displayed frame, kept in KV storage across reboots.
+// Display_Fast/Display_Async skip the refresh when the frame is unchanged.
+UDOUBLE EPD_4IN0E_FrameChecksum(const UBYTE *Image);
+UBYTE   EPD_4IN0E_IsFrameShown(const UBYTE *Image);
+
+// Non-blocking refresh: upload, then POWER_ON/REFRESH/POWER_OFF run off the BUSY pin.
+// No other EPD_4IN0E_* call may be made until Cb has run or WaitRefresh returned 0.
+UBYTE EPD_4IN0E_RefreshAsync(EPD_4IN0E_REFRESH_CB Cb, void *Arg);
+UBYTE EPD_4IN0E_Display_Async(UBYTE *Image, EPD_4IN0E_REFRESH_CB Cb, void *Arg);
+UBYTE EPD_4IN0E_Display_StreamAsync(DEV_STREAM_FILL Fill, void *Arg, EPD_4IN0E_REFRESH_CB Cb, void *CbArg);
+UBYTE EPD_4IN0E_IsRefreshing(void);
+UBYTE EPD_4IN0E_WaitRefresh(UDOUBLE Timeout_ms);
+
+// Panel session: Open brings the panel to READY from any state with the least work,
+// Sleep parks it in deep sleep with the module still up, Close shuts everything down.
+UBYTE EPD_4IN0E_SessionOpen(void);
+void  EPD_4IN0E_SessionSleep(void);
+void  EPD_4IN0E_SessionClose(void);
+void  EPD_4IN0E_GetSession(EPD_4IN0E_SESSION *Session);
+
+// Controller registers over 3-wire SPI; 0 read, 1 no answer
+UBYTE EPD_4IN0E_ReadStatus(UBYTE *Status);
+UBYTE EPD_4IN0E_ReadTemperature(int8_t *Temp_C);
+UBYTE EPD_4IN0E_ReadRevision(UBYTE *Rev, UBYTE Len);
+
+// Upload a test frame at rising SPI clocks and keep the fastest reliable one in KV.
+// Freqs ascending, NULL for the built-in list; returns the chosen clock, 0 if none passed.
+UDOUBLE EPD_4IN0E_SpiSweep(const UDOUBLE *Freqs, UBYTE Count, EPD_4IN0E_SWEEP_STEP *Steps);
+UDOUBLE EPD_4IN0E_GetSpiFreq(void);
+
+// Per-device API; the calls above drive EPD_4IN0E_Default() on DEV_DefaultPort
+void              EPD_4IN0E_Dev_Setup(EPD_4IN0E_DEVICE *Dev, const DEV_PORT *Port, const char *KvKey);
+EPD_4IN0E_DEVICE *EPD_4IN0E_Default(void);
+
+void    EPD_4IN0E_Dev_Init(EPD_4IN0E_DEVICE *Dev);
+void    EPD_4IN0E_Dev_Clear(EPD_4IN0E_DEVICE *Dev, UBYTE color);
+void    EPD_4IN0E_Dev_Show7Block(EPD_4IN0E_DEVICE *Dev);
+void    EPD_4IN0E_Dev_Show(EPD_4IN0E_DEVICE *Dev);
+void    EPD_4IN0E_Dev_Display(EPD_4IN0E_DEVICE *Dev, UBYTE *Image);
+void    EPD_4IN0E_Dev_Sleep(EPD_4IN0E_DEVICE *Dev);
+void    EPD_4IN0E_Dev_Display_Fast(EPD_4IN0E_DEVICE *Dev, UBYTE *Image);
+UBYTE   EPD_4IN0E_Dev_Display_Stream(EPD_4IN0E_DEVICE *Dev, DEV_STREAM_FILL Fill, void *Arg);
+void    EPD_4IN0E_Dev_SetPalette(EPD_4IN0E_DEVICE *Dev, const UBYTE *Map);
+UBYTE   EPD_4IN0E_Dev_SetOrientation(EPD_4IN0E_DEVICE *Dev, UWORD Rotate, UBYTE Mirror);
+void    EPD_4IN0E_Dev_GetTransferStats(EPD_4IN0E_DEVICE *Dev, EPD_4IN0E_TRANSFER_STATS *Stats);
+void    EPD_4IN0E_Dev_GetBusyStats(EPD_4IN0E_DEVICE *Dev, EPD_4IN0E_BUSY_PHASE Phase, EPD_4IN0E_BUSY_STATS *Stats);
+UDOUBLE EPD_4IN0E_Dev_FrameChecksum(EPD_4IN0E_DEVICE *Dev, const UBYTE *Image);
+UBYTE   EPD_4IN0E_Dev_IsFrameShown(EPD_4IN0E_DEVICE *Dev, const UBYTE *Image);
+UBYTE   EPD_4IN0E_Dev_RefreshAsync(EPD_4IN0E_DEVICE *Dev, EPD_4IN0E_REFRESH_CB Cb, void *Arg);
+UBYTE   EPD_4IN0E_Dev_Display_Async(EPD_4IN0E_DEVICE *Dev, UBYTE *Image, EPD_4IN0E_REFRESH_CB Cb, void *Arg);
+UBYTE   EPD_4IN0E_Dev_Display_StreamAsync(EPD_4IN0E_DEVICE *Dev, DEV_STREAM_FILL Fill, void *Arg,
+                                          EPD_4IN0E_REFRESH_CB Cb, void *CbArg);
+UBYTE   EPD_4IN0E_Dev_IsRefreshing(EPD_4IN0E_DEVICE *Dev);
+UBYTE   EPD_4IN0E_Dev_WaitRefresh(EPD_4IN0E_DEVICE *Dev, UDOUBLE Timeout_ms);
+UBYTE   EPD_4IN0E_Dev_SessionOpen(EPD_4IN0E_DEVICE *Dev);
+void    EPD_4IN0E_Dev_SessionSleep(EPD_4IN0E_DEVICE *Dev);
+void    EPD_4IN0E_Dev_SessionClose(EPD_4IN0E_DEVICE *Dev);
+void    EPD_4IN0E_Dev_GetSession(EPD_4IN0E_DEVICE *Dev, EPD_4IN0E_SESSION *Session);
+UBYTE   EPD_4IN0E_Dev_ReadStatus(EPD_4IN0E_DEVICE *Dev, UBYTE *Status);
+UBYTE   EPD_4IN0E_Dev_ReadTemperature(EPD_4IN0E_DEVICE *Dev, int8_t *Temp_C);
+UBYTE   EPD_4IN0E_Dev_ReadRevision(EPD_4IN0E_DEVICE *Dev, UBYTE *Rev, UBYTE Len);
+UDOUBLE EPD_4IN0E_Dev_SpiSweep(EPD_4IN0E_DEVICE *Dev, const UDOUBLE *Freqs, UBYTE Count,
+                               EPD_4IN0E_SWEEP_STEP *Steps);
+UDOUBLE EPD_4IN0E_Dev_GetSpiFreq(EPD_4IN0E_DEVICE *Dev);
+
 #endif
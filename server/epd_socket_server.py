@@ -17,6 +17,7 @@ EPD Socket Server - 电子纸网络测试服务端 (增强版)
 - 支持 "update" 命令返回下一张图片信息
 - 支持扫描 bmp 图片目录并轮询
 - 支持下载图片二进制数据
+- 支持下发字体包 (lib/Fonts/font_blob.py 生成)
 - 记录连接和通信日志
 
 使用方法:
@@ -45,6 +46,7 @@ import time
 DEFAULT_HOST = "0.0.0.0"
 DEFAULT_PORT = 18888
 DEFAULT_IMAGE_DIR = "./dist"
+DEFAULT_FONT_BLOB = "./fonts.bin"
 BUFFER_SIZE = 8192
 FILE_CHECK_INTERVAL = 5  # 检查文件变化的时间间隔（秒）
 FILE_CHANGE_DEBOUNCE = 5  # 文件变化防抖动时间（秒）
@@ -129,10 +131,11 @@ def get_file_checksums(image_dir: str) -> Dict[str, tuple]:
 class EPDSocketServer:
     """EPD Socket 服务器类"""
 
-    def __init__(self, host: str = DEFAULT_HOST, port: int = DEFAULT_PORT, image_dir: str = DEFAULT_IMAGE_DIR, enable_file_monitor: bool = True):
+    def __init__(self, host: str = DEFAULT_HOST, port: int = DEFAULT_PORT, image_dir: str = DEFAULT_IMAGE_DIR, enable_file_monitor: bool = True, font_blob: str = DEFAULT_FONT_BLOB):
         self.host = host
         self.port = port
         self.image_dir = image_dir
+        self.font_blob = font_blob
         self.image_list: List[str] = []
         self.current_index = 0
         self.lock = threading.Lock()
@@ -463,6 +466,37 @@ class EPDSocketServer:
             client_socket.sendall(error_msg.encode('utf-8'))
             return False
 
+    def send_font_blob(self, client_socket: socket.socket) -> bool:
+        """
+        发送字体包，设备保存后不再重复下载
+
+        发送格式: 4字节长度(大端) + 字体包
+
+        Args:
+            client_socket: 客户端 socket
+
+        Returns:
+            True 表示成功
+        """
+        try:
+            with open(self.font_blob, 'rb') as f:
+                data = f.read()
+
+            header = struct.pack('>I', len(data))
+            client_socket.sendall(header + data)
+
+            log_message(f"Sent font blob: {self.font_blob} ({len(data)} bytes)")
+            return True
+
+        except Exception as e:
+            log_message(f"Failed to send font blob: {e}", "ERROR")
+            error_msg = json.dumps({
+                "status": "error",
+                "message": str(e)
+            }, ensure_ascii=False)
+            client_socket.sendall(error_msg.encode('utf-8'))
+            return False
+
     def handle_client(self, client_socket: socket.socket, client_addr: tuple) -> None:
         """处理客户端连接"""
         log_message(f"Client connected: {client_addr[0]}:{client_addr[1]}")
@@ -496,6 +530,11 @@ class EPDSocketServer:
                         self.send_c_array_data(client_socket)
                         continue
 
+                    # get_font 命令 - 发送字体包
+                    if command_lower == "get_font":
+                        self.send_font_blob(client_socket)
+                        continue
+
                     # info 命令 - 获取当前图片信息（不推进索引）
                     if command_lower == "info":
                         image_info = self.get_current_image_info()
@@ -764,6 +803,7 @@ def main():
     update   - 返回下一张图片信息（循环）
     info     - 返回当前图片信息（不推进索引）
     get      - 下载当前图片的二进制数据
+    get_font - 下载字体包 (--font-blob)
     list     - 返回所有图片列表
     status   - 返回设备状态
     refresh  - 返回刷新状态
@@ -798,6 +838,13 @@ def main():
         help=f"BMP 图片目录 (默认: {DEFAULT_IMAGE_DIR})"
     )
 
+    parser.add_argument(
+        "--font-blob",
+        type=str,
+        default=DEFAULT_FONT_BLOB,
+        help=f"get_font 下发的字体包, 由 lib/Fonts/font_blob.py 生成 (默认: {DEFAULT_FONT_BLOB})"
+    )
+
     parser.add_argument(
         "-v", "--verbose",
         action="store_true",
@@ -811,7 +858,7 @@ def main():
         log_message(f"Image directory: {args.image_dir}")
 
     # 创建并运行服务器
-    server = EPDSocketServer(host=args.host, port=args.port, image_dir=args.image_dir)
+    server = EPDSocketServer(host=args.host, port=args.port, image_dir=args.image_dir, font_blob=args.font_blob)
     server.run()
 
 
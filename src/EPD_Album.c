@@ -31,7 +31,33 @@
 #define SOCKET_SERVER_PORT 18888            // socket服务端口
 #define RECV_BUFFER_SIZE   1024
 #define LOOP_INTERVAL_MS   180000 // 循环间隔
-#define IMAGE_BUFFER_SIZE  120000 // 400x600 屏幕 6 色格式大小 (400*600/2)
+#define IMAGE_BUFFER_SIZE  120000 // 400x600 屏幕 6 色格式大小 (400*600/2)，流式写入屏幕，不再整帧缓存
+#define REFRESH_TIMEOUT_MS 60000  // 异步刷新最长等待时间
+
+/***********************************************************
+ *                    屏幕安装方向
+ ***********************************************************/
+// 旋转 90/270 时服务器数据按 600x400 横向画面解释; 非默认方向需整帧缓存后再上传
+#define ALBUM_ROTATE EPD_4IN0E_ROTATE_0
+#define ALBUM_MIRROR EPD_4IN0E_MIRROR_NONE
+// 默认方向时边下载边上传，否则整帧缓存
+#define ALBUM_STREAM_DIRECT (ALBUM_ROTATE == EPD_4IN0E_ROTATE_0 && ALBUM_MIRROR == EPD_4IN0E_MIRROR_NONE)
+
+/***********************************************************
+ *                    SPI 时钟
+ ***********************************************************/
+// 首次启动时逐级提高 SPI 时钟上传测试画面，最快的稳定时钟存入 KV，之后上电直接使用
+// 更换排线后删除 KV 项 "epd_spi_hz" 即可重新测速
+#define ALBUM_SPI_SWEEP 1
+
+/***********************************************************
+ *                    字体包
+ ***********************************************************/
+// 启动时从 KV 项 "epd_fonts" 加载字体包 (lib/Fonts/font_blob.py 生成)，没有时向服务器发送 get_font 下载一次并保存
+// 服务器换了字体后删除该 KV 项即可重新下载; 以 FONT_BUILTIN=0 编译时固件本身不带字模，全部来自字体包
+#define ALBUM_FONT_BLOB     1
+#define FONT_BLOB_KV_KEY   "epd_fonts"
+#define FONT_BLOB_MAX_SIZE 65536
 
 /***********************************************************
  *                    全局变量
@@ -40,16 +66,37 @@ static volatile bool g_wifi_connected   = false;
 static volatile bool g_socket_connected = false;
 static int           g_image_index      = 0;
 static int           g_image_total      = 0;
+static bool          g_refresh_pending  = false; // 上一帧仍在异步刷新
+static uint8_t      *g_font_blob        = NULL;  // 正在使用的字体包, 描述符直接指向其中，不再释放
+
+/**
+ * 流式显示: 一帧图片数据的接收状态
+ */
+typedef struct {
+    int      fd;       // get_c 连接
+    uint32_t size;     // 长度头给出的字节数
+    uint32_t received; // 已接收字节数
+} album_stream_t;
 
 /***********************************************************
  *                    函数声明
  ***********************************************************/
-static void wifi_event_callback(WF_EVENT_E event, void *arg);
-static int  socket_send_command(const char *cmd, char *response, int resp_size);
-static int  socket_recv_json_response(char *response, int resp_size);
-static int  socket_get_image_data(uint8_t *data, uint32_t *data_size);
-static int  wifi_connect_wait(void);
-static void print_hex_dump(const uint8_t *data, uint32_t len, uint32_t max_lines);
+static void    wifi_event_callback(WF_EVENT_E event, void *arg);
+static int     socket_send_command(const char *cmd, char *response, int resp_size);
+static int     socket_recv_json_response(char *response, int resp_size);
+static int     socket_open_data(const char *cmd, uint32_t *data_size);
+static int     socket_open_image(uint32_t *image_size);
+static int     socket_get_font(uint8_t **blob, uint32_t *blob_size);
+static void    album_font_load(void);
+static UDOUBLE album_stream_fill(UBYTE *buf, UDOUBLE size, UDOUBLE offset, void *arg);
+static int     wifi_connect_wait(void);
+static void    print_hex_dump(const uint8_t *data, uint32_t len, uint32_t max_lines);
+static void    album_refresh_done(void *arg);
+static void    album_finish_refresh(void);
+static int     album_display(album_stream_t *stream);
+#if !ALBUM_STREAM_DIRECT
+static int     album_display_buffered(album_stream_t *stream);
+#endif
 
 /**
  * @brief WiFi 事件回调函数
@@ -89,6 +136,35 @@ static void wifi_event_callback(WF_EVENT_E event, void *arg)
     }
 }
 
+/**
+ * @brief 异步刷新完成回调 (定时器线程中执行)
+ */
+static void album_refresh_done(void *arg)
+{
+    EPD_4IN0E_BUSY_STATS st;
+
+    (void)arg;
+    // 刷新完成立即进入深度睡眠 (SPI 保持配置，下一轮直接唤醒)
+    EPD_4IN0E_SessionSleep();
+    EPD_4IN0E_GetBusyStats(EPD_4IN0E_BUSY_REFRESH, &st);
+    PR_INFO("Refresh done in %u ms (min %u / avg %u / max %u over %u), enter Sleep mode", st.Last_ms, st.Min_ms,
+            st.Avg_ms, st.Max_ms, st.Count);
+}
+
+/**
+ * @brief 等待上一帧的异步刷新结束
+ */
+static void album_finish_refresh(void)
+{
+    if (!g_refresh_pending) {
+        return;
+    }
+    if (EPD_4IN0E_WaitRefresh(REFRESH_TIMEOUT_MS) != 0) {
+        PR_ERR("Display refresh timeout");
+    }
+    g_refresh_pending = false;
+}
+
 /**
  * @brief 等待WiFi连接
  * @return 0 成功, -1 超时失败
@@ -227,11 +303,12 @@ static void display_network_result(int status, const char *message)
  */
 int EPD_test_net(void)
 {
-    OPERATE_RET op_ret = OPRT_OK;
-    char        response[RECV_BUFFER_SIZE];
-    uint8_t    *image_buffer = NULL;
-    uint32_t    image_size   = 0;
-    uint32_t    loop_count   = 0;
+    OPERATE_RET       op_ret = OPRT_OK;
+    char              response[RECV_BUFFER_SIZE];
+    album_stream_t    stream;
+    uint32_t          loop_count = 0;
+    EPD_4IN0E_SESSION session;
+    int               ret;
 
     PR_DEBUG("========== EPD Network Test Start ==========");
     PR_DEBUG("WiFi SSID: %s", WIFI_SSID);
@@ -250,6 +327,24 @@ int EPD_test_net(void)
     // DEV_Delay_ms(500);
     // ==========================================================
 
+    // 初始化 KV 存储 (保存屏上画面的校验值，重启后仍可跳过相同画面)
+    tal_kv_init(&(tal_kv_cfg_t){
+        .seed = "vmlkasdh93dlvlcy",
+        .key  = "dflfuap134ddlduq",
+    });
+
+    // 服务器 get_c 数据按 黑白黄红蓝绿 顺序编号 0-5，上传时映射为屏幕颜色索引
+    EPD_4IN0E_SetPalette(EPD_4IN0E_PALETTE_SEQUENTIAL);
+    EPD_4IN0E_SetOrientation(ALBUM_ROTATE, ALBUM_MIRROR);
+
+#if ALBUM_SPI_SWEEP
+    if (EPD_4IN0E_GetSpiFreq() == 0) {
+        PR_DEBUG("SPI clock sweep...");
+        PR_DEBUG("SPI clock: %u Hz", EPD_4IN0E_SpiSweep(NULL, 0, NULL));
+        EPD_4IN0E_SessionSleep();
+    }
+#endif
+
     // 初始化WiFi
     PR_DEBUG("Initializing WiFi...");
     op_ret = tal_wifi_init(wifi_event_callback);
@@ -280,6 +375,10 @@ int EPD_test_net(void)
         return -1;
     }
 
+#if ALBUM_FONT_BLOB
+    album_font_load();
+#endif
+
     PR_DEBUG("WiFi connected, entering main loop...");
 
     // ========== 主循环: 每15秒获取一次数据 ==========
@@ -369,61 +468,45 @@ int EPD_test_net(void)
         // ========== 第三步: 发送 get_c 命令获取 C 数组数据 ==========
         PR_DEBUG("Step 3: Sending 'get_c' command...");
 
-        // 分配图片缓冲区
-        image_buffer = (uint8_t *)malloc(IMAGE_BUFFER_SIZE);
-        if (image_buffer == NULL) {
-            PR_ERR("Failed to allocate memory for image");
-            tal_system_sleep(LOOP_INTERVAL_MS);
-            continue;
-        }
+        // 上一帧刷新结束后控制器才能接收新数据
+        album_finish_refresh();
 
-        if (socket_get_image_data(image_buffer, &image_size) != 0) {
+        memset(&stream, 0, sizeof(stream));
+        stream.fd = socket_open_image(&stream.size);
+        if (stream.fd < 0) {
             PR_ERR("Failed to get image data");
-            free(image_buffer);
-            image_buffer = NULL;
             tal_system_sleep(LOOP_INTERVAL_MS);
             continue;
         }
 
-        PR_INFO("Image downloaded successfully: %u bytes", image_size);
-
-        // 显示十六进制数据（前20字节）
-        PR_DEBUG("Displaying first 20 bytes of image data:");
-        print_hex_dump(image_buffer, image_size, 2);
-
-        // ========== 第四步: 显示图片到 e-Paper ==========
-        PR_DEBUG("Step 4: Displaying image on e-Paper...");
+        // ========== 第四步: 边下载边写入 e-Paper ==========
+        PR_DEBUG("Step 4: Streaming image to e-Paper...");
 
-        // 初始化模块
-        if (DEV_Module_Init() != 0) {
-            PR_ERR("DEV Module Init failed");
-            free(image_buffer);
-            image_buffer = NULL;
+        // 唤醒屏幕: 首次完整初始化，之后 SPI 保持配置，只从深度睡眠复位并重载寄存器
+        if (EPD_4IN0E_SessionOpen() != 0) {
+            PR_ERR("e-Paper session open failed");
+            tal_net_close(stream.fd);
             tal_system_sleep(LOOP_INTERVAL_MS);
             continue;
         }
-
-        // 初始化屏幕
-        EPD_4IN0E_Init();
-
-        // 显示图片 (使用 get_c 返回的 6 色数据)
-        EPD_4IN0E_Display_Fast(image_buffer);
-
-        PR_INFO("Image displayed successfully");
-
-        // 等待显示刷新完成 (30秒)
-        PR_DEBUG("Waiting 30s for display refresh to complete...");
-        DEV_Delay_ms(30000);
-
-        // 进入睡眠
-        PR_INFO("Enter Sleep mode");
-        EPD_4IN0E_Sleep();
-        DEV_Delay_ms(500);
-        DEV_Module_Exit();
-
-        // 释放内存
-        free(image_buffer);
-        image_buffer = NULL;
+        EPD_4IN0E_GetSession(&session);
+        PR_DEBUG("e-Paper ready in %u ms, saved %u ms (total %u ms)", session.Setup_ms, session.Saved_ms,
+                 session.SavedTotal_ms);
+
+        // 每收到一块数据立即经 SPI 写入控制器，下载与上传重叠，不再需要 120KB 缓冲区
+        // 收满长度头给出的字节数后才刷新，刷新由 BUSY 引脚驱动在后台进行，完成后回调进入睡眠
+        // 与屏上画面相同时跳过刷新
+        ret = album_display(&stream);
+        if (ret == 0) {
+            g_refresh_pending = true;
+            PR_INFO("Image streamed: %u bytes, refreshing in background", stream.received);
+        } else if (ret == 1) {
+            PR_INFO("Image streamed: %u bytes, shown", stream.received);
+        } else {
+            PR_ERR("Image stream incomplete: %u/%u bytes", stream.received, stream.size);
+            EPD_4IN0E_SessionSleep();
+        }
+        tal_net_close(stream.fd);
 
         // ========== 等待下一次循环 ==========
         PR_DEBUG("Waiting %d ms before next update...", LOOP_INTERVAL_MS);
@@ -501,21 +584,19 @@ static int socket_recv_json_response(char *response, int resp_size)
 }
 
 /**
- * @brief 获取图片二进制数据
- * @param data 接收图片数据的缓冲区
- * @param data_size 图片数据大小
- * @return 0 成功, -1 失败
+ * @brief 发送命令并接收 4 字节长度头 (get_c / get_font)
+ * @param cmd 命令
+ * @param data_size 长度头给出的字节数
+ * @return socket 句柄 (数据待读取), -1 失败
  */
-static int socket_get_image_data(uint8_t *data, uint32_t *data_size)
+static int socket_open_data(const char *cmd, uint32_t *data_size)
 {
     int            fd = -1;
     TUYA_IP_ADDR_T server_addr;
     TUYA_ERRNO     conn_ret;
     uint8_t        header[4];
-    uint32_t       image_size = 0;
-    uint32_t       received   = 0;
 
-    if (data == NULL || data_size == NULL) {
+    if (cmd == NULL || data_size == NULL) {
         PR_ERR("Invalid parameters");
         return -1;
     }
@@ -547,8 +628,8 @@ static int socket_get_image_data(uint8_t *data, uint32_t *data_size)
         return -1;
     }
 
-    // 发送 "get_c" 命令
-    TUYA_ERRNO send_ret = tal_net_send(fd, "get_c", 5);
+    // 发送命令
+    TUYA_ERRNO send_ret = tal_net_send(fd, cmd, strlen(cmd));
     if (send_ret < 0) {
         PR_ERR("Send command failed");
         tal_net_close(fd);
@@ -564,42 +645,203 @@ static int socket_get_image_data(uint8_t *data, uint32_t *data_size)
         return -1;
     }
 
-    // 解析图片大小（大端）
-    image_size = (header[0] << 24) | (header[1] << 16) | (header[2] << 8) | header[3];
-    PR_DEBUG("Image size: %u bytes", image_size);
+    // 解析数据大小（大端）
+    *data_size = ((uint32_t)header[0] << 24) | (header[1] << 16) | (header[2] << 8) | header[3];
+    PR_DEBUG("%s size: %u bytes", cmd, *data_size);
 
-    // 检查大小是否超过缓冲区
-    if (image_size > IMAGE_BUFFER_SIZE) {
-        PR_ERR("Image size %u exceeds buffer size %u", image_size, IMAGE_BUFFER_SIZE);
+    return fd;
+}
+
+/**
+ * @brief 发送 get_c 命令并接收长度头
+ * @param image_size 图片数据大小
+ * @return socket 句柄 (图片数据待读取), -1 失败
+ */
+static int socket_open_image(uint32_t *image_size)
+{
+    int fd = socket_open_data("get_c", image_size);
+
+    if (fd < 0) {
+        return -1;
+    }
+
+    // 直接写入屏幕，必须正好是一整帧
+    if (*image_size != IMAGE_BUFFER_SIZE) {
+        PR_ERR("Image size %u does not match frame size %u", *image_size, IMAGE_BUFFER_SIZE);
         tal_net_close(fd);
         return -1;
     }
-    *data_size = image_size;
 
-    // 接收图片数据
-    received = 0;
-    while (received < image_size) {
-        uint32_t to_recv = image_size - received;
-        if (to_recv > 4096) {
-            to_recv = 4096;
-        }
-        recv_ret = tal_net_recv(fd, data + received, to_recv);
+    return fd;
+}
+
+/**
+ * @brief 发送 get_font 命令下载字体包
+ * @param blob 字体包 (malloc 分配，4 字节对齐)
+ * @param blob_size 字体包字节数
+ * @return 0 成功, -1 失败
+ */
+static int socket_get_font(uint8_t **blob, uint32_t *blob_size)
+{
+    uint32_t received = 0;
+    int      fd       = socket_open_data("get_font", blob_size);
+
+    if (fd < 0) {
+        return -1;
+    }
+
+    // 服务器没有字体包时回复 JSON 错误，长度头不合理
+    if (*blob_size < sizeof(FONT_BLOB_HEADER) || *blob_size > FONT_BLOB_MAX_SIZE) {
+        PR_ERR("Font blob size %u out of range", *blob_size);
+        tal_net_close(fd);
+        return -1;
+    }
+
+    *blob = (uint8_t *)malloc(*blob_size);
+    if (*blob == NULL) {
+        PR_ERR("Failed to allocate memory for font blob");
+        tal_net_close(fd);
+        return -1;
+    }
+
+    while (received < *blob_size) {
+        TUYA_ERRNO recv_ret = tal_net_recv(fd, *blob + received, *blob_size - received);
         if (recv_ret <= 0) {
-            PR_ERR("Failed to receive image data at %u/%u", received, image_size);
+            PR_ERR("Failed to receive font blob at %u/%u", received, *blob_size);
+            free(*blob);
+            *blob = NULL;
             tal_net_close(fd);
             return -1;
         }
         received += recv_ret;
     }
 
-    PR_DEBUG("Received %u bytes image data", received);
-
-    // 关闭socket
     tal_net_close(fd);
-
     return 0;
 }
 
+/**
+ * @brief 加载字体包: 先用 KV 中保存的，没有或损坏时从服务器下载并保存
+ * @note 失败时继续使用固件内置字模
+ */
+static void album_font_load(void)
+{
+    uint8_t *blob = NULL;
+    size_t   len  = 0;
+    uint32_t size = 0;
+    int      count;
+
+    if (tal_kv_get(FONT_BLOB_KV_KEY, &blob, &len) == OPRT_OK && blob != NULL) {
+        count = Font_BlobAttach(blob, len);
+        if (count >= 0) {
+            g_font_blob = blob;
+            PR_INFO("Font blob from KV: %d fonts, %u bytes", count, (uint32_t)len);
+            return;
+        }
+        PR_ERR("Font blob in KV is invalid, downloading again");
+        tal_kv_free(blob);
+        blob = NULL;
+    }
+
+    if (socket_get_font(&blob, &size) != 0) {
+        PR_ERR("No font blob, using the built-in fonts");
+        return;
+    }
+    count = Font_BlobAttach(blob, size);
+    if (count < 0) {
+        PR_ERR("Font blob from server is invalid");
+        free(blob);
+        return;
+    }
+    g_font_blob = blob;
+    tal_kv_set(FONT_BLOB_KV_KEY, blob, size);
+    PR_INFO("Font blob from server: %d fonts, %u bytes", count, size);
+}
+
+/**
+ * @brief 流式显示的数据源: 从 socket 接收下一块图片数据
+ * @note 在主线程中运行，与上一块的 SPI 发送重叠; 尽量填满整块，保持画面校验值与整帧计算一致
+ * @return 本块字节数, 0 表示数据结束或接收失败
+ */
+static UDOUBLE album_stream_fill(UBYTE *buf, UDOUBLE size, UDOUBLE offset, void *arg)
+{
+    album_stream_t *stream = (album_stream_t *)arg;
+    UDOUBLE         got    = 0;
+
+    while (got < size && stream->received < stream->size) {
+        TUYA_ERRNO recv_ret = tal_net_recv(stream->fd, buf + got, size - got);
+        if (recv_ret <= 0) {
+            PR_ERR("Failed to receive image data at %u/%u", stream->received, stream->size);
+            break;
+        }
+        got += recv_ret;
+        stream->received += recv_ret;
+    }
+
+    // 显示十六进制数据（前20字节）
+    if (offset == 0 && got > 0) {
+        PR_DEBUG("Displaying first 20 bytes of image data:");
+        print_hex_dump(buf, got, 2);
+    }
+    return got;
+}
+
+/**
+ * @brief 按安装方向显示下载中的一帧
+ * @return 0 已在后台刷新, 1 已显示完成 (画面相同或阻塞刷新，已进入睡眠), -1 数据不完整
+ */
+static int album_display(album_stream_t *stream)
+{
+#if ALBUM_STREAM_DIRECT
+    if (EPD_4IN0E_Display_StreamAsync(album_stream_fill, stream, album_refresh_done, NULL) != 0) {
+        return -1;
+    }
+    // 返回 0 也可能是跳过或阻塞刷新，回调已执行
+    return EPD_4IN0E_IsRefreshing() ? 0 : 1;
+#else
+    return album_display_buffered(stream);
+#endif
+}
+
+#if !ALBUM_STREAM_DIRECT
+/**
+ * @brief 整帧下载后按安装方向上传 (旋转需要随机访问整帧数据)
+ * @return 0 已在后台刷新, 1 已显示完成, -1 下载失败
+ */
+static int album_display_buffered(album_stream_t *stream)
+{
+    uint8_t *image_buffer = (uint8_t *)malloc(IMAGE_BUFFER_SIZE);
+    uint32_t offset       = 0;
+    int      ret;
+
+    if (image_buffer == NULL) {
+        PR_ERR("Failed to allocate memory for image");
+        return -1;
+    }
+
+    while (offset < stream->size) {
+        UDOUBLE got = album_stream_fill(image_buffer + offset, stream->size - offset, offset, stream);
+        if (got == 0) {
+            free(image_buffer);
+            return -1;
+        }
+        offset += got;
+    }
+
+    // 旋转/镜像在上传时逐块完成，不需要第二个整帧缓冲区
+    if (EPD_4IN0E_Display_Async(image_buffer, album_refresh_done, NULL) != 0) {
+        // 无法异步刷新时退回阻塞方式
+        EPD_4IN0E_Display_Fast(image_buffer);
+        EPD_4IN0E_SessionSleep();
+        ret = 1;
+    } else {
+        ret = EPD_4IN0E_IsRefreshing() ? 0 : 1; // 画面相同时回调已执行
+    }
+    free(image_buffer);
+    return ret;
+}
+#endif
+
 /**
  * @brief 打印十六进制数据（显示前20字节）
  * @param data 数据缓冲区
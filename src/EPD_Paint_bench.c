@@ -0,0 +1,233 @@
+/*****************************************************************************
+ * | File      	:   EPD_Paint_bench.c
+ * | Author      :   e-Paper Album
+ * | Function    :   Per-pixel cost of the GUI_Paint writers
+ * | Info        :
+ *   Fills a 400 x 600 image pixel by pixel for every scale and rotation and
+ *   prints the cost per pixel of the former switch-based Paint_SetPixel(),
+ *   of the range-checked Paint_SetPixel() and of Paint_SetPixelFast().
+ *   Then times the span fills on the 4bpp canvas against memset() and
+ *   text with and without the glyph cache.
+ *----------------
+ * |	This version:   V1.0
+ * | Date        :   2026-10-16
+ * | Info        :
+ ******************************************************************************/
+#include "EPD_Test.h"
+#include "EPD_4in0e.h"
+
+#define BENCH_PASSES 8
+#define FILL_PASSES  256
+#define TEXT_PASSES  64
+
+/**
+ * Paint_SetPixel() before the writers were bound: both switches and the
+ * scale chain run for every pixel
+ **/
+static void bench_legacy_pixel(UWORD Xpoint, UWORD Ypoint, UWORD Color)
+{
+    if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
+        return;
+    }
+    UWORD X, Y;
+    switch (Paint.Rotate) {
+    case 0:
+        X = Xpoint;
+        Y = Ypoint;
+        break;
+    case 90:
+        X = Paint.WidthMemory - Ypoint - 1;
+        Y = Xpoint;
+        break;
+    case 180:
+        X = Paint.WidthMemory - Xpoint - 1;
+        Y = Paint.HeightMemory - Ypoint - 1;
+        break;
+    case 270:
+        X = Ypoint;
+        Y = Paint.HeightMemory - Xpoint - 1;
+        break;
+    default:
+        return;
+    }
+
+    switch (Paint.Mirror) {
+    case MIRROR_NONE:
+        break;
+    case MIRROR_HORIZONTAL:
+        X = Paint.WidthMemory - X - 1;
+        break;
+    case MIRROR_VERTICAL:
+        Y = Paint.HeightMemory - Y - 1;
+        break;
+    case MIRROR_ORIGIN:
+        X = Paint.WidthMemory - X - 1;
+        Y = Paint.HeightMemory - Y - 1;
+        break;
+    default:
+        return;
+    }
+
+    if (X >= Paint.WidthMemory || Y >= Paint.HeightMemory) {
+        return;
+    }
+
+    if (Paint.Scale == 2) {
+        UDOUBLE Addr  = X / 8 + Y * Paint.WidthByte;
+        UBYTE   Rdata = Paint.Image[Addr];
+        if (Color == BLACK)
+            Paint.Image[Addr] = Rdata & ~(0x80 >> (X % 8));
+        else
+            Paint.Image[Addr] = Rdata | (0x80 >> (X % 8));
+    } else if (Paint.Scale == 4) {
+        UDOUBLE Addr = X / 4 + Y * Paint.WidthByte;
+        Color        = Color % 4;
+        UBYTE Rdata  = Paint.Image[Addr];
+
+        Rdata             = Rdata & (~(0xC0 >> ((X % 4) * 2)));
+        Paint.Image[Addr] = Rdata | ((Color << 6) >> ((X % 4) * 2));
+    } else if (Paint.Scale == 7 || Paint.Scale == 16) {
+        UDOUBLE Addr      = X / 2 + Y * Paint.WidthByte;
+        UBYTE   Rdata     = Paint.Image[Addr];
+        Rdata             = Rdata & (~(0xF0 >> ((X % 2) * 4)));
+        Paint.Image[Addr] = Rdata | ((Color << 4) >> ((X % 2) * 4));
+    }
+}
+
+/**
+ * Nanoseconds per pixel of one writer over BENCH_PASSES full images
+ **/
+static UDOUBLE bench_run(UBYTE Mode)
+{
+    UDOUBLE Start = tal_system_get_millisecond();
+    UDOUBLE Pixels;
+    UWORD   X, Y, Pass;
+
+    for (Pass = 0; Pass < BENCH_PASSES; Pass++) {
+        for (Y = 0; Y < Paint.Height; Y++) {
+            for (X = 0; X < Paint.Width; X++) {
+                if (Mode == 0)
+                    bench_legacy_pixel(X, Y, (X ^ Y ^ Pass) & 0x07);
+                else if (Mode == 1)
+                    Paint_SetPixel(X, Y, (X ^ Y ^ Pass) & 0x07);
+                else
+                    Paint_SetPixelFast(X, Y, (X ^ Y ^ Pass) & 0x07);
+            }
+        }
+    }
+    Pixels = (UDOUBLE)Paint.Width * Paint.Height * BENCH_PASSES;
+    return (UDOUBLE)((uint64_t)(tal_system_get_millisecond() - Start) * 1000000 / Pixels);
+}
+
+/**
+ * Throughput in KB/s of Passes fills of Bytes each
+ **/
+static UDOUBLE bench_rate(SYS_TIME_T Start, UDOUBLE Bytes, UWORD Passes)
+{
+    SYS_TIME_T Ms = tal_system_get_millisecond() - Start;
+
+    return Ms ? (UDOUBLE)((uint64_t)Bytes * Passes / Ms) : 0;
+}
+
+/**
+ * Span fills of the 4bpp canvas, full and odd-aligned, against plain memset()
+ **/
+static void bench_fills(UBYTE *Image)
+{
+    UDOUBLE    Size = EPD_4IN0E_WIDTH / 2 * EPD_4IN0E_HEIGHT;
+    SYS_TIME_T Start;
+    UWORD      Pass;
+
+    Paint_NewImage(Image, EPD_4IN0E_WIDTH, EPD_4IN0E_HEIGHT, ROTATE_0, WHITE);
+    Paint_SetScale(7);
+
+    Start = tal_system_get_millisecond();
+    for (Pass = 0; Pass < FILL_PASSES; Pass++)
+        memset(Image, Pass & 0xFF, Size);
+    PR_DEBUG("memset             %8u KB/s\r\n", bench_rate(Start, Size, FILL_PASSES));
+
+    Start = tal_system_get_millisecond();
+    for (Pass = 0; Pass < FILL_PASSES; Pass++)
+        Paint_Clear(Pass & 0x07);
+    PR_DEBUG("Paint_Clear        %8u KB/s\r\n", bench_rate(Start, Size, FILL_PASSES));
+
+    Start = tal_system_get_millisecond();
+    for (Pass = 0; Pass < FILL_PASSES; Pass++)
+        Paint_ClearWindows(1, 1, Paint.Width - 1, Paint.Height - 1, Pass & 0x07);
+    PR_DEBUG("Paint_ClearWindows %8u KB/s\r\n", bench_rate(Start, Size, FILL_PASSES));
+
+    Paint_SetRotate(ROTATE_90);
+    Start = tal_system_get_millisecond();
+    for (Pass = 0; Pass < FILL_PASSES; Pass++)
+        Paint_DrawRectangle(1, 1, Paint.Width - 1, Paint.Height - 1, Pass & 0x07, DOT_PIXEL_1X1, DRAW_FILL_FULL);
+    PR_DEBUG("filled rect 90     %8u KB/s\r\n", bench_rate(Start, Size, FILL_PASSES));
+}
+
+/**
+ * Nanoseconds per Font24 character on the 4bpp canvas, with the glyph cache
+ * of Paint attached or detached
+ **/
+static UDOUBLE bench_text(UBYTE Cached)
+{
+    static const char Line[] = "Network Test 12:34:56 OK";
+    PAINT_GLYPH_CACHE *Glyphs = Paint.Glyphs;
+    SYS_TIME_T         Start;
+    UWORD              Pass, Y;
+    UDOUBLE            Chars = 0;
+
+    if (!Cached)
+        Paint.Glyphs = NULL;
+    Start = tal_system_get_millisecond();
+    for (Pass = 0; Pass < TEXT_PASSES; Pass++) {
+        for (Y = 0; Y + Font24.Height <= Paint.Height; Y += Font24.Height) {
+            Paint_DrawString_EN(0, Y, Line, &Font24, Pass & 0x07, (Pass & 1) ? FONT_BACKGROUND : EPD_4IN0E_WHITE);
+            Chars += sizeof(Line) - 1;
+        }
+    }
+    Paint.Glyphs = Glyphs;
+    return (UDOUBLE)((uint64_t)(tal_system_get_millisecond() - Start) * 1000000 / Chars);
+}
+
+/**
+ * @brief Per-pixel cost of the Paint_SetPixel variants and fill throughput
+ */
+int EPD_test_paint_bench(void)
+{
+    static const UBYTE Scales[] = {2, 4, 7};
+    UWORD              Rotate;
+    UDOUBLE            Text;
+    UBYTE              s;
+    UBYTE             *Image = (UBYTE *)malloc(EPD_4IN0E_WIDTH / 2 * EPD_4IN0E_HEIGHT);
+
+    if (Image == NULL) {
+        PR_DEBUG("Failed to apply for black memory...\r\n");
+        return -1;
+    }
+
+    PR_DEBUG("scale rotate   legacy  checked     fast (ns/pixel)\r\n");
+    for (s = 0; s < sizeof(Scales); s++) {
+        for (Rotate = ROTATE_0; Rotate <= ROTATE_270; Rotate += 90) {
+            UDOUBLE Legacy, Checked, Fast;
+
+            Paint_NewImage(Image, EPD_4IN0E_WIDTH, EPD_4IN0E_HEIGHT, Rotate, WHITE);
+            Paint_SetScale(Scales[s]);
+            Paint_SetMirroring(MIRROR_HORIZONTAL);
+            Legacy  = bench_run(0);
+            Checked = bench_run(1);
+            Fast    = bench_run(2);
+            PR_DEBUG("%5d %6d %8u %8u %8u\r\n", Scales[s], Rotate, Legacy, Checked, Fast);
+        }
+    }
+    bench_fills(Image);
+
+    Paint_NewImage(Image, EPD_4IN0E_WIDTH, EPD_4IN0E_HEIGHT, ROTATE_0, WHITE);
+    Paint_SetScale(7);
+    Text = bench_text(0);
+    PR_DEBUG("Font24 per-pixel   %8u ns/char\r\n", Text);
+    Text = bench_text(1);
+    PR_DEBUG("Font24 glyph cache %8u ns/char (%u hits, %u misses)\r\n", Text, Paint.Glyphs->Hits,
+             Paint.Glyphs->Misses);
+
+    free(Image);
+    return 0;
+}
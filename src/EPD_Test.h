@@ -40,4 +40,6 @@
 
 int EPD_test(void);
 int EPD_test_net(void);
+int EPD_test_trace(void);
+int EPD_test_paint_bench(void);
 #endif
@@ -0,0 +1,105 @@
+/*****************************************************************************
+ * | File      	:   EPD_Trace_test.c
+ * | Author      :   e-Paper Album
+ * | Function    :   Byte-level comparison of the 4in0e transfer modes
+ * | Info        :
+ *   Records EPD_4IN0E_Display() and EPD_4IN0E_Display_Fast() with DEV_Trace,
+ *   prints their transaction, byte and GPIO toggle counts and checks both
+ *   against the command sequence recorded for one full frame. On DEV_SIM
+ *   builds the second trace is replayed into the panel model.
+ *----------------
+ * |	This version:   V1.0
+ * | Date        :   2026-10-16
+ * | Info        :
+ ******************************************************************************/
+#include "EPD_Test.h"
+#include "EPD_4in0e.h"
+#include "DEV_Trace.h"
+#if DEV_SIM
+#include "DEV_Sim.h"
+#endif
+
+// One frame plus headroom for commands, pin writes and time tags
+#define TRACE_BUF_SIZE (140 * 1024)
+
+/**
+ * Recorded from EPD_4IN0E_Display() of one frame after EPD_4IN0E_SessionOpen():
+ * DTM (0x10) with the frame, then POWER_ON, second setting, DISPLAY_REFRESH and
+ * POWER_OFF with 6 parameter bytes. Update when EPD_4IN0E_RefreshSeq changes.
+ **/
+#define TRACE_GOLDEN_CMDSUM   0xEF487B0E
+#define TRACE_GOLDEN_COMMANDS 5
+#define TRACE_GOLDEN_DATA     (EPD_4IN0E_WIDTH / 2 * EPD_4IN0E_HEIGHT + 6)
+
+static int trace_report(const char *Name, const UBYTE *Trace, UDOUBLE Len)
+{
+    DEV_TRACE_STATS Stats;
+
+    DEV_Trace_Analyze(Trace, Len, NULL, &Stats);
+    PR_DEBUG("%-13s trace %u B: %u transactions, %u SPI calls, %u commands, %u data bytes, "
+             "%u pin writes, %u toggles, %u ms, cmd sum %08x%s\r\n",
+             Name, Len, Stats.Transactions, Stats.SpiCalls, Stats.Commands, Stats.DataBytes, Stats.PinWrites,
+             Stats.Toggles, Stats.Duration_ms, Stats.CmdSum, Stats.Truncated ? " (truncated)" : "");
+
+    if (Stats.Truncated || Stats.CmdSum != TRACE_GOLDEN_CMDSUM || Stats.Commands != TRACE_GOLDEN_COMMANDS ||
+        Stats.DataBytes != TRACE_GOLDEN_DATA) {
+        PR_DEBUG("%s: expected cmd sum %08x, %u commands, %u data bytes:\r\n", Name, TRACE_GOLDEN_CMDSUM,
+                 TRACE_GOLDEN_COMMANDS, TRACE_GOLDEN_DATA);
+        DEV_Trace_Print(Trace, Len, NULL);
+        return -1;
+    }
+    return 0;
+}
+
+/**
+ * @brief Trace Display against Display_Fast
+ */
+int EPD_test_trace(void)
+{
+    UDOUBLE Len;
+    UBYTE  *Trace;
+    int     Ret;
+
+#if !DEV_TRACE
+    PR_DEBUG("trace test needs DEV_TRACE=1\r\n");
+    return -1;
+#endif
+    Trace = (UBYTE *)malloc(TRACE_BUF_SIZE);
+    if (Trace == NULL) {
+        PR_DEBUG("Failed to apply for trace memory...\r\n");
+        return -1;
+    }
+    if (EPD_4IN0E_SessionOpen() != 0) {
+        free(Trace);
+        return -1;
+    }
+
+    DEV_Trace_Start(Trace, TRACE_BUF_SIZE);
+    EPD_4IN0E_Display((UBYTE *)BMP_1);
+    Len = DEV_Trace_Stop();
+    Ret = trace_report("Display", Trace, Len);
+
+    EPD_4IN0E_Clear(EPD_4IN0E_WHITE); // Display_Fast skips a frame that is already shown
+
+    DEV_Trace_Start(Trace, TRACE_BUF_SIZE);
+    EPD_4IN0E_Display_Fast((UBYTE *)BMP_1);
+    Len = DEV_Trace_Stop();
+    Ret |= trace_report("Display_Fast", Trace, Len);
+
+#if DEV_SIM
+    {
+        DEV_SIM_STATS Before, After;
+
+        EPD_4IN0E_Clear(EPD_4IN0E_WHITE);
+        DEV_Sim_GetStats(NULL, &Before);
+        DEV_Trace_Replay(Trace, Len, NULL);
+        DEV_Sim_GetStats(NULL, &After);
+        PR_DEBUG("replay: %u refreshes, %u protocol errors\r\n", After.Refreshes - Before.Refreshes,
+                 After.Errors - Before.Errors);
+    }
+#endif
+
+    EPD_4IN0E_SessionClose();
+    free(Trace);
+    return Ret;
+}